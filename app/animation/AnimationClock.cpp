@@ -0,0 +1,37 @@
+#include "AnimationClock.h"
+
+#include <cmath>
+
+namespace pacman::app {
+
+/**
+ * @brief Returns the singleton AnimationClock instance.
+ * @return Reference to the global animation clock.
+ */
+AnimationClock& AnimationClock::getInstance() {
+    static AnimationClock clock;
+    return clock;
+}
+
+/**
+ * @brief Advances the clock by the duration of the last frame.
+ * @param seconds Frame time in seconds (ignored if not positive).
+ */
+void AnimationClock::advance(double seconds) noexcept {
+    if (!(seconds > 0.0)) {
+        return;
+    }
+
+    micros_ += static_cast<std::uint64_t>(std::llround(seconds * 1'000'000.0));
+    nowMs_ = static_cast<std::uint32_t>(micros_ / 1000u);
+}
+
+/**
+ * @brief Resets the clock to zero.
+ */
+void AnimationClock::reset() noexcept {
+    micros_ = 0;
+    nowMs_ = 0;
+}
+
+} // namespace pacman::app
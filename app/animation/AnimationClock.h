@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstdint>
+
+namespace pacman::app {
+
+/**
+ * @brief Singleton clock shared by all sprite animations, in whole milliseconds.
+ *
+ * The game loop advances it once per rendered frame; views only read nowMs(), so picking an animation frame
+ * is pure integer work and every sprite in a frame sees the same time.
+ */
+class AnimationClock {
+public:
+    /**
+     * @brief Returns the singleton AnimationClock instance.
+     * @return Reference to the global animation clock.
+     */
+    static AnimationClock& getInstance();
+
+    /**
+     * @brief Advances the clock by the duration of the last frame.
+     * @param seconds Frame time in seconds (ignored if not positive).
+     */
+    void advance(double seconds) noexcept;
+
+    /**
+     * @brief Resets the clock to zero.
+     */
+    void reset() noexcept;
+
+    /**
+     * @brief Returns the animation time.
+     * @return Milliseconds accumulated since the last reset (wraps after ~49 days).
+     */
+    std::uint32_t nowMs() const noexcept { return nowMs_; }
+
+private:
+    AnimationClock() = default;
+    ~AnimationClock() = default;
+
+    AnimationClock(const AnimationClock&) = delete;
+    AnimationClock& operator=(const AnimationClock&) = delete;
+
+private:
+    std::uint64_t micros_{0}; ///< Accumulated time; keeps sub-millisecond remainders between frames
+    std::uint32_t nowMs_{0};
+};
+
+} // namespace pacman::app
@@ -0,0 +1,198 @@
+#include "AnimationLibrary.h"
+
+#include "../resources/ResourceCache.h"
+
+namespace pacman::app {
+
+namespace {
+constexpr AnimationLibrary::ClipId kDirectionSlots = 5; ///< Right, Down, Left, Up, None
+constexpr AnimationLibrary::ClipId kGhostKinds = 4;
+
+constexpr AnimationLibrary::ClipId kPacManFirst = 0;
+constexpr AnimationLibrary::ClipId kGhostFirst = kPacManFirst + kDirectionSlots;
+constexpr AnimationLibrary::ClipId kFrightened = kGhostFirst + kGhostKinds * kDirectionSlots;
+constexpr AnimationLibrary::ClipId kClipCount = kFrightened + 1;
+
+constexpr unsigned int kPacManCol = 17;
+
+constexpr unsigned int kPacManRowClosed = 0;
+constexpr unsigned int kPacManRowSmall[4] = {1, 4, 7, 10}; ///< Right, Down, Left, Up
+constexpr unsigned int kPacManRowBig[4] = {2, 5, 8, 11};   ///< Right, Down, Left, Up
+
+constexpr unsigned int kGhostCol[kGhostKinds] = {13, 14, 15, 16}; ///< GhostKind A-D
+constexpr unsigned int kGhostRow[4] = {0, 2, 4, 6};               ///< First walking frame: Right, Down, Left, Up
+
+constexpr unsigned int kFearCol1 = 0;
+constexpr unsigned int kFearCol2 = 1;
+constexpr unsigned int kFearRow1 = 11;
+constexpr unsigned int kFearRow2 = 12;
+
+constexpr std::uint16_t kPacManFrameMs = 50;  ///< 400 ms mouth cycle in eight steps
+constexpr std::uint16_t kGhostFrameMs = 125;  ///< 8 Hz walking animation
+constexpr std::uint16_t kStillFrameMs = 1000; ///< Single-frame clips
+
+/**
+ * @brief Maps a direction to its slot in a per-actor block of clips.
+ * @param dir Facing direction.
+ * @return Slot index (Right, Down, Left, Up, None).
+ */
+AnimationLibrary::ClipId directionSlot(logic::Direction dir) noexcept {
+    switch (dir) {
+    case logic::Direction::Right:
+        return 0;
+    case logic::Direction::Down:
+        return 1;
+    case logic::Direction::Left:
+        return 2;
+    case logic::Direction::Up:
+        return 3;
+    case logic::Direction::None:
+    default:
+        return 4;
+    }
+}
+} // namespace
+
+/**
+ * @brief Returns the singleton AnimationLibrary, building the frame table on first use.
+ * @return Reference to the global animation library.
+ */
+AnimationLibrary& AnimationLibrary::getInstance() {
+    static AnimationLibrary library;
+    return library;
+}
+
+/**
+ * @brief Builds every clip from the cached sprite sheet grid.
+ *
+ * Frame timings reproduce the previous time-based animation: Pac-Man's mouth stays closed for 100 ms, half open
+ * for 150 ms, fully open for 100 ms and closed again for 50 ms; ghosts alternate two frames at 8 Hz and
+ * frightened ghosts additionally flash between two colours at 2 Hz.
+ */
+AnimationLibrary::AnimationLibrary() {
+    const SpriteGrid* grid =
+        ResourceCache::getInstance().grid(assets::SpriteSheet, assets::SheetCols, assets::SheetRows);
+    if (!grid) {
+        return;
+    }
+
+    clips_.resize(kClipCount);
+    frames_.reserve(64);
+
+    for (unsigned int d = 0; d < 4; ++d) {
+        const unsigned int closed = kPacManRowClosed;
+        const unsigned int small = kPacManRowSmall[d];
+        const unsigned int big = kPacManRowBig[d];
+
+        addClip(*grid, static_cast<ClipId>(kPacManFirst + d), kPacManFrameMs,
+                {{kPacManCol, closed},
+                 {kPacManCol, closed},
+                 {kPacManCol, small},
+                 {kPacManCol, small},
+                 {kPacManCol, small},
+                 {kPacManCol, big},
+                 {kPacManCol, big},
+                 {kPacManCol, closed}});
+    }
+    addClip(*grid, kPacManFirst + 4, kStillFrameMs, {{kPacManCol, kPacManRowClosed}});
+
+    for (unsigned int k = 0; k < kGhostKinds; ++k) {
+        const auto first = static_cast<ClipId>(kGhostFirst + k * kDirectionSlots);
+        const unsigned int col = kGhostCol[k];
+
+        for (unsigned int d = 0; d < 4; ++d) {
+            addClip(*grid, static_cast<ClipId>(first + d), kGhostFrameMs,
+                    {{col, kGhostRow[d]}, {col, kGhostRow[d] + 1u}});
+        }
+        addClip(*grid, static_cast<ClipId>(first + 4), kStillFrameMs, {{col, kGhostRow[0]}});
+    }
+
+    addClip(*grid, kFrightened, kGhostFrameMs,
+            {{kFearCol1, kFearRow1},
+             {kFearCol1, kFearRow2},
+             {kFearCol1, kFearRow1},
+             {kFearCol1, kFearRow2},
+             {kFearCol2, kFearRow1},
+             {kFearCol2, kFearRow2},
+             {kFearCol2, kFearRow1},
+             {kFearCol2, kFearRow2}});
+}
+
+/**
+ * @brief Stores a clip made of sprite sheet cells.
+ * @param grid Cell rectangles of the sprite sheet.
+ * @param id Clip identifier the clip is stored under.
+ * @param frameMs Duration of one frame in milliseconds.
+ * @param cells Sheet cells as (column, row) pairs, in playback order.
+ */
+void AnimationLibrary::addClip(const SpriteGrid& grid, ClipId id, std::uint16_t frameMs,
+                               std::initializer_list<std::pair<unsigned int, unsigned int>> cells) {
+    AnimationClip& clip = clips_[id];
+    clip.first = static_cast<std::uint32_t>(frames_.size());
+    clip.count = static_cast<std::uint16_t>(cells.size());
+    clip.frameMs = frameMs;
+
+    for (const auto& [col, row] : cells) {
+        frames_.push_back(grid.at(col, row));
+    }
+}
+
+/**
+ * @brief Returns the Pac-Man clip for a facing direction.
+ * @param dir Facing direction (None gives the closed-mouth frame).
+ * @return Clip identifier.
+ */
+AnimationLibrary::ClipId AnimationLibrary::pacManClip(logic::Direction dir) noexcept {
+    return static_cast<ClipId>(kPacManFirst + directionSlot(dir));
+}
+
+/**
+ * @brief Returns the walking clip of a ghost.
+ * @param kind Ghost kind (selects the sheet column).
+ * @param dir Facing direction (None gives a still frame).
+ * @return Clip identifier.
+ */
+AnimationLibrary::ClipId AnimationLibrary::ghostClip(logic::GhostKind kind, logic::Direction dir) noexcept {
+    auto k = static_cast<ClipId>(kind);
+    if (k >= kGhostKinds) {
+        k = 0;
+    }
+    return static_cast<ClipId>(kGhostFirst + k * kDirectionSlots + directionSlot(dir));
+}
+
+/**
+ * @brief Returns the clip shared by all ghosts in fear mode.
+ * @return Clip identifier.
+ */
+AnimationLibrary::ClipId AnimationLibrary::frightenedClip() noexcept { return kFrightened; }
+
+/**
+ * @brief Returns the frame of a clip that is shown at the given animation time.
+ * @param clip Clip identifier.
+ * @param nowMs Animation time in milliseconds.
+ * @return Zero-based frame index within the clip.
+ */
+std::uint16_t AnimationLibrary::frameIndex(ClipId clip, std::uint32_t nowMs) const noexcept {
+    if (clip >= clips_.size() || clips_[clip].count <= 1) {
+        return 0;
+    }
+
+    const AnimationClip& c = clips_[clip];
+    return static_cast<std::uint16_t>((nowMs / c.frameMs) % c.count);
+}
+
+/**
+ * @brief Returns the texture rectangle of a clip frame.
+ * @param clip Clip identifier.
+ * @param frame Zero-based frame index within the clip.
+ * @return Texture rectangle (empty if the clip or frame does not exist).
+ */
+const sf::IntRect& AnimationLibrary::frame(ClipId clip, std::uint16_t frame) const noexcept {
+    static const sf::IntRect empty{};
+    if (clip >= clips_.size() || frame >= clips_[clip].count) {
+        return empty;
+    }
+    return frames_[clips_[clip].first + frame];
+}
+
+} // namespace pacman::app
@@ -0,0 +1,118 @@
+#pragma once
+
+#include "../logic/entities/Direction.h"
+#include "../logic/factory/AbstractFactory.h"
+
+#include <SFML/Graphics/Rect.hpp>
+
+#include <cstdint>
+#include <initializer_list>
+#include <utility>
+#include <vector>
+
+namespace pacman::app {
+
+class SpriteGrid;
+
+/**
+ * @brief A looping run of equally long frames inside AnimationLibrary's frame table.
+ */
+struct AnimationClip {
+    std::uint32_t first{0};   ///< Index of the first frame in the frame table
+    std::uint16_t count{0};   ///< Number of frames (0 if the clip could not be built)
+    std::uint16_t frameMs{1}; ///< Duration of one frame in milliseconds
+};
+
+/**
+ * @brief Singleton table of every Pac-Man and ghost animation frame on the sprite sheet.
+ *
+ * All texture rectangles are computed once from the cached sprite sheet grid. Views pick a clip when their
+ * direction or mode changes and sample it with the shared AnimationClock, which is one division and one modulo
+ * per draw.
+ */
+class AnimationLibrary {
+public:
+    using ClipId = std::uint16_t;
+
+    /**
+     * @brief Returns the singleton AnimationLibrary, building the frame table on first use.
+     * @return Reference to the global animation library.
+     */
+    static AnimationLibrary& getInstance();
+
+    /**
+     * @brief Returns whether the frame table was built (false if the sprite sheet failed to load).
+     * @return True if clips can be sampled.
+     */
+    bool ready() const noexcept { return !frames_.empty(); }
+
+    /**
+     * @brief Returns the Pac-Man clip for a facing direction.
+     * @param dir Facing direction (None gives the closed-mouth frame).
+     * @return Clip identifier.
+     */
+    static ClipId pacManClip(logic::Direction dir) noexcept;
+
+    /**
+     * @brief Returns the walking clip of a ghost.
+     * @param kind Ghost kind (selects the sheet column).
+     * @param dir Facing direction (None gives a still frame).
+     * @return Clip identifier.
+     */
+    static ClipId ghostClip(logic::GhostKind kind, logic::Direction dir) noexcept;
+
+    /**
+     * @brief Returns the clip shared by all ghosts in fear mode.
+     * @return Clip identifier.
+     */
+    static ClipId frightenedClip() noexcept;
+
+    /**
+     * @brief Returns the frame of a clip that is shown at the given animation time.
+     * @param clip Clip identifier.
+     * @param nowMs Animation time in milliseconds.
+     * @return Zero-based frame index within the clip.
+     */
+    std::uint16_t frameIndex(ClipId clip, std::uint32_t nowMs) const noexcept;
+
+    /**
+     * @brief Returns the texture rectangle of a clip frame.
+     * @param clip Clip identifier.
+     * @param frame Zero-based frame index within the clip.
+     * @return Texture rectangle (empty if the clip or frame does not exist).
+     */
+    const sf::IntRect& frame(ClipId clip, std::uint16_t frame) const noexcept;
+
+    /**
+     * @brief Returns the texture rectangle of a clip at the given animation time.
+     * @param clip Clip identifier.
+     * @param nowMs Animation time in milliseconds.
+     * @return Texture rectangle of the current frame.
+     */
+    const sf::IntRect& sample(ClipId clip, std::uint32_t nowMs) const noexcept {
+        return frame(clip, frameIndex(clip, nowMs));
+    }
+
+private:
+    AnimationLibrary();
+    ~AnimationLibrary() = default;
+
+    AnimationLibrary(const AnimationLibrary&) = delete;
+    AnimationLibrary& operator=(const AnimationLibrary&) = delete;
+
+    /**
+     * @brief Stores a clip made of sprite sheet cells.
+     * @param grid Cell rectangles of the sprite sheet.
+     * @param id Clip identifier the clip is stored under.
+     * @param frameMs Duration of one frame in milliseconds.
+     * @param cells Sheet cells as (column, row) pairs, in playback order.
+     */
+    void addClip(const SpriteGrid& grid, ClipId id, std::uint16_t frameMs,
+                 std::initializer_list<std::pair<unsigned int, unsigned int>> cells);
+
+private:
+    std::vector<AnimationClip> clips_;
+    std::vector<sf::IntRect> frames_;
+};
+
+} // namespace pacman::app
@@ -10,7 +10,7 @@
 #include "../views/FruitView.h"
 #include "../views/GhostView.h"
 #include "../views/PacManView.h"
-#include "../views/WallView.h"
+#include "../views/WallLayer.h"
 
 namespace pacman::app {
 
@@ -60,7 +60,7 @@ std::shared_ptr<logic::Fruit> ConcreteFactory::createFruit() {
 }
 
 /**
- * @brief Creates a Wall model and attaches its corresponding view.
+ * @brief Creates a Wall model and adds it to the shared wall layer.
  * @return Shared pointer to the created Wall model.
  */
 std::shared_ptr<logic::Wall> ConcreteFactory::createWall() {
@@ -146,16 +146,29 @@ void ConcreteFactory::attachViewToModel(const std::shared_ptr<logic::Fruit>& fru
 }
 
 /**
- * @brief Attaches a WallView to the given Wall model.
- * @param wall The Wall model to attach the view to.
+ * @brief Adds the given Wall model to the shared wall layer, registering the layer on first use.
+ * @param wall The Wall model to add.
  */
 void ConcreteFactory::attachViewToModel(const std::shared_ptr<logic::Wall>& wall) {
     if (!wall) {
         return;
     }
 
-    auto view = std::make_unique<WallView>(wall);
-    views_.add(std::move(view));
+    if (!wallLayer_) {
+        auto layer = std::make_unique<WallLayer>();
+        wallLayer_ = layer.get();
+        views_.add(std::move(layer));
+    }
+
+    wallLayer_->addWall(wall);
+}
+
+/**
+ * @brief Removes all views created so far, including the shared wall layer.
+ */
+void ConcreteFactory::clearViews() {
+    views_.clear();
+    wallLayer_ = nullptr;
 }
 
 } // namespace pacman::app
\ No newline at end of file
@@ -4,6 +4,7 @@
 
 #include "../logic/score/Score.h"
 #include "../views/ViewRegistry.h"
+#include "../views/WallLayer.h"
 
 #include <memory>
 
@@ -63,7 +64,7 @@ public:
     std::shared_ptr<logic::Fruit> createFruit() override;
 
     /**
-     * @brief Creates a Wall model and attaches its view.
+     * @brief Creates a Wall model and adds it to the wall layer.
      * @return Shared pointer to the created Wall model.
      */
     std::shared_ptr<logic::Wall> createWall() override;
@@ -80,10 +81,18 @@ public:
      */
     ViewRegistry& views() noexcept { return views_; }
 
+    /**
+     * @brief Removes all views created so far, including the shared wall layer.
+     *
+     * Use this instead of views().clear() before the world recreates its entities.
+     */
+    void clearViews();
+
 private:
     sf::RenderWindow* window_;
     pacman::logic::Score* scoreObserver_{nullptr};
     ViewRegistry views_;
+    WallLayer* wallLayer_{nullptr}; ///< Owned by views_, created with the first wall
 
     /**
      * @brief Attaches the PacMan view and observers to the given model.
@@ -110,7 +119,7 @@ private:
     void attachViewToModel(const std::shared_ptr<logic::Fruit>& fruit);
 
     /**
-     * @brief Attaches the Wall view to the given model.
+     * @brief Adds the given wall to the shared wall layer.
      * @param wall The Wall model instance.
      */
     void attachViewToModel(const std::shared_ptr<logic::Wall>& wall);
@@ -7,13 +7,25 @@
 #include "../states/StateManager.h"
 #include "../states/VictoryState.h"
 
+#include "../animation/AnimationClock.h"
+#include "../resources/ResourceCache.h"
+#include "../ui/ProfilerOverlay.h"
 #include "../views/View.h"
 
+#include "utils/AllocationCounter.h"
+#include "utils/FrameTelemetry.h"
+#include "utils/LatencyTracker.h"
+#include "utils/Profiler.h"
+#include "utils/StartupTimeline.h"
 #include "utils/Stopwatch.h"
+#include "utils/TraceRecorder.h"
 
 #include <SFML/Graphics.hpp>
 #include <SFML/Window/Event.hpp>
 
+#include <chrono>
+#include <iostream>
+
 namespace pacman::app {
 
 /**
@@ -21,15 +33,26 @@ namespace pacman::app {
  * @param width Window width in pixels.
  * @param height Window height in pixels.
  * @param title Window title string.
+ * @param tickRate Simulation steps per second (0 falls back to DefaultTickRate).
  */
-Game::Game(unsigned width, unsigned height, const char* title)
+Game::Game(unsigned width, unsigned height, const char* title, unsigned tickRate)
     : window_(sf::VideoMode(width, height), title, sf::Style::Titlebar | sf::Style::Close),
-      camera_(static_cast<int>(width), static_cast<int>(height)) {
-    window_.setFramerateLimit(60);
+      camera_(static_cast<int>(width), static_cast<int>(height)),
+      fixedDt_(1.0 / static_cast<double>(tickRate > 0 ? tickRate : DefaultTickRate)) {
+    pacman::logic::StartupTimeline::getInstance().mark("window created");
+    window_.setFramerateLimit(DefaultFrameRate);
 
     View::setCamera(&camera_);
 
+#if defined(PACMAN_PROFILE)
+    profilerFont_ = ResourceCache::getInstance().font(assets::MainFont);
+    if (profilerFont_) {
+        profilerOverlay_ = std::make_unique<ProfilerOverlay>(*profilerFont_);
+    }
+#endif
+
     prepareStateManager();
+    pacman::logic::StartupTimeline::getInstance().mark("states ready");
 
     pacman::logic::Stopwatch::getInstance().reset();
 }
@@ -50,48 +73,194 @@ void Game::prepareStateManager() {
 }
 
 /**
- * @brief Runs the main game loop: event processing, fixed-step updates, and rendering.
+ * @brief Runs the main game loop: event processing, fixed-step state updates, and rendering.
+ *
+ * A running level steps its world on its own SimulationThread; the fixed steps here only poll it.
  */
 void Game::run() {
     auto& stopwatch = pacman::logic::Stopwatch::getInstance();
     stopwatch.reset();
 
-    window_.setFramerateLimit(60);
+    auto& animationClock = AnimationClock::getInstance();
+    animationClock.reset();
+
+    auto& latency = pacman::logic::LatencyTracker::getInstance();
+    pacman::logic::TraceRecorder::getInstance().registerThread("main");
+
+    using Clock = std::chrono::steady_clock;
+    const auto seconds = [](Clock::duration d) { return std::chrono::duration<double>(d).count(); };
 
-    const double fixedDt = 1.0 / 60.0;
     const double maxFrameDt = 0.25;
     double accumulator = 0.0;
+    bool firstFrame = true;
 
     while (window_.isOpen()) {
-        sf::Event event{};
-        while (window_.pollEvent(event)) {
-            if (event.type == sf::Event::Closed) {
-                window_.close();
+        pacman::logic::FrameTelemetry::Frame frame;
+
+#if defined(PACMAN_ALLOC_TRACKING)
+        // Main-thread allocations only; the simulation thread counts its own World::update scopes.
+        const pacman::logic::AllocationScope frameAllocations("frame");
+#endif
+        {
+            PACMAN_PROFILE_SCOPE(pacman::logic::ProfilePhase::Events);
+            PACMAN_TRACE_SCOPE("frame", "events");
+            PACMAN_ALLOC_SCOPE("frame.events");
+
+            // F3 prints the startup timeline and latency percentiles, F5 writes the trace so far, F4 toggles the
+            // profiler and its overlay. All three are printed or written again on exit.
+            sf::Event event{};
+            while (window_.pollEvent(event)) {
+                if (event.type == sf::Event::Closed) {
+                    window_.close();
+                }
+                if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::F3) {
+                    std::cout << pacman::logic::StartupTimeline::getInstance().report() << latency.report()
+                              << std::flush;
+                }
+                if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::F5) {
+                    flushTrace();
+                }
+#if defined(PACMAN_PROFILE)
+                if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::F4) {
+                    auto& profiler = pacman::logic::Profiler::getInstance();
+                    profiler.setEnabled(!profiler.enabled());
+                }
+#endif
+                stateManager_->handleEvent(event);
             }
-            stateManager_->handleEvent(event);
         }
 
         if (!window_.isOpen()) {
             break;
         }
 
-        stopwatch.tick();
+        // Not a profiler phase: LevelState times the update around each simulation step on its own thread.
+        {
+            PACMAN_TRACE_SCOPE("frame", "update");
+            PACMAN_ALLOC_SCOPE("frame.update");
+
+            const auto updateStart = Clock::now();
+            stopwatch.tick();
+
+            double frameDt = stopwatch.deltaTime();
+            frame.frameSeconds = frameDt;
+            if (frameDt > maxFrameDt) {
+                frameDt = maxFrameDt;
+                frame.overflow = true;
+            }
 
-        double frameDt = stopwatch.deltaTime();
-        if (frameDt > maxFrameDt) {
-            frameDt = maxFrameDt;
+            accumulator += frameDt;
+            animationClock.advance(frameDt);
+
+            // What is left in the accumulator is not used for interpolation: LevelState::draw interpolates by the
+            // age of the latest render snapshot, the game over replay by its own accumulator.
+            while (accumulator >= fixedDt_) {
+                stateManager_->update(fixedDt_);
+                accumulator -= fixedDt_;
+                ++frame.stateUpdates;
+            }
+
+            frame.stateUpdateSeconds = seconds(Clock::now() - updateStart);
         }
 
-        accumulator += frameDt;
+        {
+            PACMAN_PROFILE_SCOPE(pacman::logic::ProfilePhase::Draw);
+            PACMAN_TRACE_SCOPE("frame", "draw");
+            PACMAN_ALLOC_SCOPE("frame.draw");
 
-        while (accumulator >= fixedDt) {
-            stateManager_->update(fixedDt);
-            accumulator -= fixedDt;
+            const auto drawStart = Clock::now();
+            window_.clear();
+            stateManager_->draw(window_);
+#if defined(PACMAN_PROFILE)
+            if (profilerOverlay_ && pacman::logic::Profiler::getInstance().enabled()) {
+                profilerOverlay_->draw(window_);
+            }
+#endif
+            frame.drawSeconds = seconds(Clock::now() - drawStart);
         }
 
-        window_.clear();
-        stateManager_->draw(window_);
-        window_.display();
+        // Not a profiler phase either: presenting waits for the frame limit.
+        {
+            PACMAN_TRACE_SCOPE("frame", "display");
+            PACMAN_ALLOC_SCOPE("frame.display");
+            window_.display();
+        }
+        latency.displayed(); // key presses shown in this frame get their input-to-photon latency
+        if (firstFrame) {
+            pacman::logic::StartupTimeline::getInstance().mark("first frame");
+            firstFrame = false;
+        }
+        // Take over assets decoded in the background (textures are uploaded here), so the sprite sheet is resident by
+        // the time the menu starts a level.
+        ResourceCache::getInstance().pollPreloads();
+        // Written to disk by FrameTelemetry's own thread; a running level records its simulation steps itself.
+        if (telemetry_) {
+            telemetry_->record(frame);
+        }
+#if defined(PACMAN_PROFILE)
+        pacman::logic::Profiler::getInstance().endFrame();
+#endif
+#if defined(PACMAN_ALLOC_TRACKING)
+        checkAllocationBudget(frameAllocations.allocated());
+#endif
+    }
+
+    std::cout << pacman::logic::StartupTimeline::getInstance().report() << latency.report() << std::flush;
+    if (telemetry_ && telemetry_->writeFailures() > 0) {
+        std::cerr << "could not write metrics to " << telemetry_->path() << '\n';
+    }
+    if (allocationBudget_) {
+        std::cout << pacman::logic::AllocationCounter::getInstance().report() << framesOverBudget_
+                  << " steady-state frames over the budget of " << *allocationBudget_ << " allocations\n"
+                  << std::flush;
+    }
+    flushTrace();
+}
+
+/**
+ * @brief Checks the allocations of a finished frame against the budget if the frame was steady state.
+ *
+ * A frame is steady once SteadyFrames frames have passed without a state transition, so loading a level or opening
+ * a menu does not count. The first frame over the budget is reported with the per-scope table.
+ *
+ * @param frame Allocations made on the main thread during the frame.
+ */
+void Game::checkAllocationBudget(const pacman::logic::AllocationStats& frame) {
+    const std::uint64_t transitions = stateManager_->transitions();
+    if (transitions != lastTransitions_) {
+        lastTransitions_ = transitions;
+        steadyFrames_ = 0;
+        return;
+    }
+
+    if (steadyFrames_ < SteadyFrames) {
+        ++steadyFrames_;
+        return;
+    }
+
+    if (!allocationBudget_ || frame.allocations <= *allocationBudget_) {
+        return;
+    }
+
+    if (framesOverBudget_++ == 0) {
+        std::cerr << "steady-state frame made " << frame.allocations << " allocations (" << frame.bytes
+                  << " bytes), budget " << *allocationBudget_ << "\n"
+                  << pacman::logic::AllocationCounter::getInstance().report() << std::flush;
+    }
+}
+
+/**
+ * @brief Writes the trace recorded so far to the trace output, if tracing was requested.
+ */
+void Game::flushTrace() {
+    auto& tracer = pacman::logic::TraceRecorder::getInstance();
+    if (traceOutput_.empty() || !tracer.enabled()) {
+        return;
+    }
+
+    if (tracer.flush(traceOutput_)) {
+        std::cout << "trace written to " << traceOutput_ << " (" << tracer.dropped() << " events dropped)\n"
+                  << std::flush;
     }
 }
 
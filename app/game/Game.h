@@ -3,9 +3,22 @@
 #include "../states/StateManager.h"
 #include "camera/Camera.h"
 
+#if defined(PACMAN_PROFILE)
+#include "../ui/ProfilerOverlay.h"
+
+#include <SFML/Graphics/Font.hpp>
+#endif
+
+#include "utils/AllocationCounter.h"
+#include "utils/FrameTelemetry.h"
+
 #include <SFML/Graphics/RenderWindow.hpp>
 
+#include <cstdint>
 #include <memory>
+#include <optional>
+#include <string>
+#include <utility>
 
 namespace pacman::app {
 
@@ -16,24 +29,109 @@ public:
      * @param width Window width in pixels.
      * @param height Window height in pixels.
      * @param title Window title string.
+     * @param tickRate Simulation steps per second (rendering interpolates between steps).
+     */
+    Game(unsigned width, unsigned height, const char* title, unsigned tickRate = DefaultTickRate);
+
+    /**
+     * @brief Default simulation rate in steps per second.
      */
-    Game(unsigned width, unsigned height, const char* title);
+    static constexpr unsigned DefaultTickRate = 60;
+
+    /**
+     * @brief Default render rate cap in frames per second.
+     */
+    static constexpr unsigned DefaultFrameRate = 60;
+
+    /**
+     * @brief Caps the render rate, independently of the tick rate (views are interpolated between ticks).
+     * @param frameRate Frames per second, or 0 for no cap.
+     */
+    void setFrameRateLimit(unsigned frameRate) {
+        window_.setVerticalSyncEnabled(false);
+        window_.setFramerateLimit(frameRate);
+    }
+
+    /**
+     * @brief Presents frames in step with the display refresh rate instead of a fixed cap.
+     */
+    void enableVerticalSync() {
+        window_.setFramerateLimit(0);
+        window_.setVerticalSyncEnabled(true);
+    }
 
     /**
      * @brief Starts the main loop of the game.
      */
     void run();
 
+    /**
+     * @brief Sets the file the trace is written to on F5 and on exit (tracing must be enabled separately).
+     * @param path Chrome trace JSON output path.
+     */
+    void setTraceOutput(std::string path) { traceOutput_ = std::move(path); }
+
+    /**
+     * @brief Records frame health histograms and writes them to a metrics file in the background.
+     * @param path Prometheus text output path, rewritten every FrameTelemetry::DefaultFlushSeconds and on exit.
+     */
+    void setMetricsOutput(std::string path) {
+        telemetry_ = std::make_unique<pacman::logic::FrameTelemetry>(std::move(path));
+        stateManager_->ctx.telemetry = telemetry_.get();
+    }
+
+    /**
+     * @brief Frames without a state transition before a frame counts as steady state.
+     */
+    static constexpr unsigned SteadyFrames = 120;
+
+    /**
+     * @brief Sets the most heap allocations a steady-state frame may make on the main thread (needs a build with
+     * PACMAN_ALLOC_TRACKING).
+     * @param maxPerFrame Allocation budget per frame.
+     */
+    void setAllocationBudget(std::uint64_t maxPerFrame) { allocationBudget_ = maxPerFrame; }
+
+    /**
+     * @brief Returns the number of steady-state frames that exceeded the allocation budget.
+     * @return Frame count (0 without a budget).
+     */
+    std::uint64_t framesOverBudget() const { return framesOverBudget_; }
+
 private:
     /**
      * @brief Initializes the StateManager, registers state factories, and pushes the initial state.
      */
     void prepareStateManager();
 
+    /**
+     * @brief Writes the trace recorded so far to the trace output, if tracing was requested.
+     */
+    void flushTrace();
+
+    /**
+     * @brief Checks the allocations of a finished frame against the budget if the frame was steady state.
+     * @param frame Allocations made on the main thread during the frame.
+     */
+    void checkAllocationBudget(const pacman::logic::AllocationStats& frame);
+
 private:
     sf::RenderWindow window_;
     pacman::logic::Camera camera_;
+    std::unique_ptr<pacman::logic::FrameTelemetry> telemetry_; ///< Set with --metrics; outlives the level states
     std::unique_ptr<StateManager> stateManager_;
+    double fixedDt_{1.0 / DefaultTickRate}; ///< Simulation step in seconds
+    std::string traceOutput_;               ///< Empty unless started with --trace
+
+    std::optional<std::uint64_t> allocationBudget_; ///< Set with --alloc-budget
+    std::uint64_t framesOverBudget_{0};
+    std::uint64_t lastTransitions_{0};              ///< StateManager::transitions() after the previous frame
+    unsigned steadyFrames_{0};                      ///< Frames since the last state transition
+
+#if defined(PACMAN_PROFILE)
+    std::shared_ptr<const sf::Font> profilerFont_;
+    std::unique_ptr<ProfilerOverlay> profilerOverlay_; ///< Drawn while the profiler is enabled (F4)
+#endif
 };
 
 } // namespace pacman::app
\ No newline at end of file
@@ -1,7 +1,107 @@
 #include "Game.h"
 
-int main() {
-    pacman::app::Game game(800, 600, "PacMan");
+#include "../resources/ResourceCache.h"
+
+#include "utils/AllocationCounter.h"
+#include "utils/SamplingProfiler.h"
+#include "utils/StartupTimeline.h"
+#include "utils/TraceRecorder.h"
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <optional>
+
+/**
+ * @brief Entry point.
+ *
+ * Options:
+ * - "--tick-rate <hz>" changes the simulation rate (e.g. 30 on low-power hardware).
+ * - "--frame-rate <hz>" changes the render rate cap (default 60, 0 for none); "--frame-rate vsync" follows the
+ *   display refresh rate instead. Rendering interpolates between ticks, so it is independent of the tick rate.
+ * - "--trace <file>" records a Chrome trace from startup and writes it to the file on F5 and on exit.
+ * - "--metrics <file>" keeps frame and simulation step histograms and rewrites them to the file (Prometheus text
+ *   format) every 10 seconds from a background thread, and on exit.
+ * - "--sample <file>" samples call stacks with SIGPROF from startup and writes them as folded stacks on exit;
+ *   "--sample-hz <n>" changes the rate (default 997).
+ * - "--alloc-budget <n>" fails (exit code 1) if a steady-state frame made more than n heap allocations on the main
+ *   thread; needs a build with PACMAN_ALLOC_TRACKING.
+ */
+int main(int argc, char** argv) {
+    pacman::logic::StartupTimeline::getInstance().mark("main");
+
+    unsigned tickRate = pacman::app::Game::DefaultTickRate;
+    unsigned frameRate = pacman::app::Game::DefaultFrameRate;
+    bool verticalSync = false;
+    const char* tracePath = nullptr;
+    const char* metricsPath = nullptr;
+    const char* samplePath = nullptr;
+    unsigned sampleHz = pacman::logic::SamplingProfiler::DefaultHz;
+    std::optional<std::uint64_t> allocationBudget;
+    for (int i = 1; i + 1 < argc; ++i) {
+        if (std::strcmp(argv[i], "--tick-rate") == 0) {
+            tickRate = static_cast<unsigned>(std::strtoul(argv[i + 1], nullptr, 10));
+        } else if (std::strcmp(argv[i], "--frame-rate") == 0) {
+            verticalSync = std::strcmp(argv[i + 1], "vsync") == 0;
+            frameRate = static_cast<unsigned>(std::strtoul(argv[i + 1], nullptr, 10));
+        } else if (std::strcmp(argv[i], "--trace") == 0) {
+            tracePath = argv[i + 1];
+        } else if (std::strcmp(argv[i], "--metrics") == 0) {
+            metricsPath = argv[i + 1];
+        } else if (std::strcmp(argv[i], "--sample") == 0) {
+            samplePath = argv[i + 1];
+        } else if (std::strcmp(argv[i], "--sample-hz") == 0) {
+            sampleHz = static_cast<unsigned>(std::strtoul(argv[i + 1], nullptr, 10));
+        } else if (std::strcmp(argv[i], "--alloc-budget") == 0) {
+            allocationBudget = std::strtoull(argv[i + 1], nullptr, 10);
+        }
+    }
+
+    if (allocationBudget && !pacman::logic::AllocationCounter::enabled()) {
+        std::cerr << "--alloc-budget needs a build with PACMAN_ALLOC_TRACKING=ON\n";
+        return 2;
+    }
+
+    if (tracePath) {
+        pacman::logic::TraceRecorder::getInstance().setEnabled(true);
+    }
+
+    auto& sampler = pacman::logic::SamplingProfiler::getInstance();
+    if (samplePath && !sampler.start(sampleHz)) {
+        std::cerr << "sampling profiler not available on this platform\n";
+        samplePath = nullptr;
+    }
+
+    // Decode the sprite sheet and the font on worker threads while the window and the menu are created.
+    pacman::app::ResourceCache::getInstance().preloadAsync({pacman::app::assets::SpriteSheet},
+                                                           {pacman::app::assets::MainFont});
+
+    pacman::app::Game game(800, 600, "PacMan", tickRate);
+    if (verticalSync) {
+        game.enableVerticalSync();
+    } else if (frameRate != pacman::app::Game::DefaultFrameRate) {
+        game.setFrameRateLimit(frameRate);
+    }
+    if (tracePath) {
+        game.setTraceOutput(tracePath);
+    }
+    if (metricsPath) {
+        game.setMetricsOutput(metricsPath);
+    }
+    if (allocationBudget) {
+        game.setAllocationBudget(*allocationBudget);
+    }
     game.run();
-    return 0;
+
+    if (samplePath) {
+        if (sampler.writeFolded(samplePath)) {
+            std::cout << sampler.samples() << " samples written to " << samplePath << " (" << sampler.dropped()
+                      << " dropped)\n";
+        } else {
+            std::cerr << "could not write samples to " << samplePath << '\n';
+        }
+    }
+
+    return game.framesOverBudget() > 0 ? 1 : 0;
 }
\ No newline at end of file
@@ -0,0 +1,275 @@
+#include "ResourceCache.h"
+
+#include "utils/StartupTimeline.h"
+#include "utils/TraceRecorder.h"
+
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iterator>
+
+namespace pacman::app {
+
+/**
+ * @brief Computes all cell rectangles for a texture split into a regular grid.
+ * @param texture Sprite sheet texture.
+ * @param cols Number of columns.
+ * @param rows Number of rows.
+ */
+SpriteGrid::SpriteGrid(const sf::Texture& texture, unsigned int cols, unsigned int rows) : cols_(cols), rows_(rows) {
+    const auto size = texture.getSize();
+    const float cellW = static_cast<float>(size.x) / static_cast<float>(cols);
+    const float cellH = static_cast<float>(size.y) / static_cast<float>(rows);
+
+    rects_.reserve(static_cast<std::size_t>(cols) * rows);
+    for (unsigned int row = 0; row < rows; ++row) {
+        for (unsigned int col = 0; col < cols; ++col) {
+            const int left = static_cast<int>(std::round(static_cast<float>(col) * cellW));
+            const int top = static_cast<int>(std::round(static_cast<float>(row) * cellH));
+            const int right = static_cast<int>(std::round(static_cast<float>(col + 1u) * cellW));
+            const int bottom = static_cast<int>(std::round(static_cast<float>(row + 1u) * cellH));
+
+            rects_.emplace_back(left, top, right - left, bottom - top);
+        }
+    }
+}
+
+/**
+ * @brief Returns the texture rectangle of a cell.
+ * @param col Zero-based column index.
+ * @param row Zero-based row index.
+ * @return Cell rectangle in pixel coordinates (empty if out of range).
+ */
+const sf::IntRect& SpriteGrid::at(unsigned int col, unsigned int row) const noexcept {
+    static const sf::IntRect empty{};
+    if (col >= cols_ || row >= rows_) {
+        return empty;
+    }
+    return rects_[static_cast<std::size_t>(row) * cols_ + col];
+}
+
+/**
+ * @brief Returns the singleton ResourceCache instance.
+ * @return Reference to the global cache.
+ */
+ResourceCache& ResourceCache::getInstance() {
+    static ResourceCache cache;
+    return cache;
+}
+
+/**
+ * @brief Returns the texture at the given path, loading it on first use.
+ * @param path Texture file path.
+ * @return Shared texture, or nullptr if it cannot be loaded (the failure is cached too).
+ */
+std::shared_ptr<const sf::Texture> ResourceCache::texture(const std::string& path) {
+    if (auto it = textures_.find(path); it != textures_.end()) {
+        return it->second;
+    }
+
+    auto texture = std::make_shared<sf::Texture>();
+
+    if (auto pending = pendingImages_.find(path); pending != pendingImages_.end()) {
+        PACMAN_TRACE_SCOPE("resources", "uploadTexture", path);
+
+        const auto image = pending->second.get();
+        pendingImages_.erase(pending);
+        if (!image || !texture->loadFromImage(*image)) {
+            texture.reset();
+        }
+    } else {
+        PACMAN_TRACE_SCOPE("resources", "loadTexture", path);
+
+        if (!texture->loadFromFile(path)) {
+            texture.reset();
+        }
+    }
+
+    pacman::logic::StartupTimeline::getInstance().mark("texture ready", path);
+    textures_.emplace(path, texture);
+    return texture;
+}
+
+/**
+ * @brief Returns the font at the given path, loading it into memory on first use.
+ *
+ * The returned pointer shares ownership with the in-memory file bytes the font reads glyphs from.
+ *
+ * @param path Font file path.
+ * @return Shared font, or nullptr if it cannot be loaded.
+ */
+std::shared_ptr<const sf::Font> ResourceCache::font(const std::string& path) {
+    auto it = fonts_.find(path);
+    if (it == fonts_.end()) {
+        std::shared_ptr<FontData> data;
+        if (auto pending = pendingFonts_.find(path); pending != pendingFonts_.end()) {
+            data = pending->second.get();
+            pendingFonts_.erase(pending);
+        } else {
+            data = loadFont(path);
+        }
+
+        pacman::logic::StartupTimeline::getInstance().mark("font ready", path);
+        it = fonts_.emplace(path, std::move(data)).first;
+    }
+
+    if (!it->second) {
+        return nullptr;
+    }
+    return std::shared_ptr<const sf::Font>(it->second, &it->second->font);
+}
+
+/**
+ * @brief Reads a font file into memory and parses it; safe to call from any thread.
+ *
+ * sf::Font keeps its own FreeType instance, so fonts can be parsed on different threads at the same time.
+ *
+ * @param path Font file path.
+ * @return Font data, or nullptr if it cannot be loaded.
+ */
+std::shared_ptr<ResourceCache::FontData> ResourceCache::loadFont(const std::string& path) {
+    PACMAN_TRACE_SCOPE("resources", "loadFont", path);
+
+    auto data = std::make_shared<FontData>();
+
+    std::ifstream in(path, std::ios::binary);
+    data->bytes.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+
+    if (data->bytes.empty() || !data->font.loadFromMemory(data->bytes.data(), data->bytes.size())) {
+        data.reset();
+    }
+    return data;
+}
+
+/**
+ * @brief Returns the precomputed cell rectangles of a grid-based sprite sheet.
+ * @param path Texture file path.
+ * @param cols Number of grid columns.
+ * @param rows Number of grid rows.
+ * @return Grid of cell rectangles, or nullptr if the texture cannot be loaded. Stays valid for the process.
+ */
+const SpriteGrid* ResourceCache::grid(const std::string& path, unsigned int cols, unsigned int rows) {
+    auto& entry = grids_[path];
+    if (entry && entry->matches(cols, rows)) {
+        return entry.get();
+    }
+
+    const auto sheet = texture(path);
+    if (!sheet || cols == 0 || rows == 0) {
+        return nullptr;
+    }
+
+    entry = std::make_unique<SpriteGrid>(*sheet, cols, rows);
+    return entry.get();
+}
+
+/**
+ * @brief Starts decoding the given assets on worker threads and returns immediately.
+ * @param textures Texture paths.
+ * @param fonts Font paths.
+ */
+void ResourceCache::preloadAsync(const std::vector<std::string>& textures, const std::vector<std::string>& fonts) {
+    for (const auto& path : textures) {
+        if (textures_.count(path) != 0 || pendingImages_.count(path) != 0) {
+            continue;
+        }
+
+        auto decode = [path] {
+            pacman::logic::TraceRecorder::getInstance().registerThread("preload");
+
+            auto image = std::make_shared<sf::Image>();
+            {
+                PACMAN_TRACE_SCOPE("resources", "decodeImage", path);
+                if (!image->loadFromFile(path)) {
+                    image.reset();
+                }
+            }
+
+            pacman::logic::StartupTimeline::getInstance().mark("image decoded", path);
+            return image;
+        };
+        pendingImages_.emplace(path, std::async(std::launch::async, std::move(decode)));
+    }
+
+    for (const auto& path : fonts) {
+        if (fonts_.count(path) != 0 || pendingFonts_.count(path) != 0) {
+            continue;
+        }
+
+        auto parse = [path] {
+            pacman::logic::TraceRecorder::getInstance().registerThread("preload");
+
+            auto data = loadFont(path);
+            pacman::logic::StartupTimeline::getInstance().mark("font parsed", path);
+            return data;
+        };
+        pendingFonts_.emplace(path, std::async(std::launch::async, std::move(parse)));
+    }
+}
+
+/**
+ * @brief Takes over the background loads that are done, without waiting for the others.
+ *
+ * Finished images are uploaded as textures here, so this is meant to be called once per frame on the main thread.
+ * With nothing in flight it only checks two empty maps.
+ *
+ * @return Number of loads still in flight.
+ */
+std::size_t ResourceCache::pollPreloads() {
+    const auto ready = [](const auto& future) {
+        return future.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+    };
+
+    for (auto it = pendingImages_.begin(); it != pendingImages_.end();) {
+        if (!ready(it->second)) {
+            ++it;
+            continue;
+        }
+        const std::string path = (it++)->first;
+        texture(path);
+    }
+
+    for (auto it = pendingFonts_.begin(); it != pendingFonts_.end();) {
+        if (!ready(it->second)) {
+            ++it;
+            continue;
+        }
+        const std::string path = (it++)->first;
+        font(path);
+    }
+
+    return pendingImages_.size() + pendingFonts_.size();
+}
+
+/**
+ * @brief Drops textures and fonts that are referenced only by the cache.
+ *
+ * Sprite grids are kept: they are small and only hold rectangles, not the texture.
+ *
+ * @return Number of released assets.
+ */
+std::size_t ResourceCache::purgeUnused() {
+    std::size_t released = 0;
+
+    for (auto it = textures_.begin(); it != textures_.end();) {
+        if (it->second && it->second.use_count() == 1) {
+            it = textures_.erase(it);
+            ++released;
+        } else {
+            ++it;
+        }
+    }
+
+    for (auto it = fonts_.begin(); it != fonts_.end();) {
+        if (it->second && it->second.use_count() == 1) {
+            it = fonts_.erase(it);
+            ++released;
+        } else {
+            ++it;
+        }
+    }
+
+    return released;
+}
+
+} // namespace pacman::app
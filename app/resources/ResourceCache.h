@@ -0,0 +1,154 @@
+#pragma once
+
+#include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace pacman::app {
+
+namespace assets {
+inline constexpr const char* SpriteSheet = "../assets/sprites/sprite.png";
+inline constexpr const char* MainFont = "../assets/fonts/Crackman.otf";
+
+inline constexpr unsigned int SheetCols = 19; ///< Columns of the sprite sheet grid
+inline constexpr unsigned int SheetRows = 19; ///< Rows of the sprite sheet grid
+} // namespace assets
+
+/**
+ * @brief Precomputed sub-rectangles of a grid-based sprite sheet.
+ */
+class SpriteGrid {
+public:
+    /**
+     * @brief Computes all cell rectangles for a texture split into a regular grid.
+     * @param texture Sprite sheet texture.
+     * @param cols Number of columns.
+     * @param rows Number of rows.
+     */
+    SpriteGrid(const sf::Texture& texture, unsigned int cols, unsigned int rows);
+
+    /**
+     * @brief Returns the texture rectangle of a cell.
+     * @param col Zero-based column index.
+     * @param row Zero-based row index.
+     * @return Cell rectangle in pixel coordinates (empty if out of range).
+     */
+    const sf::IntRect& at(unsigned int col, unsigned int row) const noexcept;
+
+    /**
+     * @brief Returns the grid dimensions the rectangles were computed for.
+     * @return True if the grid has the given dimensions.
+     */
+    bool matches(unsigned int cols, unsigned int rows) const noexcept { return cols_ == cols && rows_ == rows; }
+
+private:
+    unsigned int cols_;
+    unsigned int rows_;
+    std::vector<sf::IntRect> rects_;
+};
+
+/**
+ * @brief Singleton cache of textures, fonts and sprite sheet grids, keyed by file path.
+ *
+ * Every asset is decoded at most once per process; later requests return the shared instance. The cache keeps
+ * a reference itself, so assets stay resident across state changes until purgeUnused() is called while no one
+ * else holds them. Fonts are read into memory once, so drawing text never touches the disk.
+ *
+ * The cache is used from the main thread only. preloadAsync() hands decoding to worker threads, which return their
+ * results through futures; the main thread picks them up in pollPreloads() or when an asset is requested.
+ */
+class ResourceCache {
+public:
+    /**
+     * @brief Returns the singleton ResourceCache instance.
+     * @return Reference to the global cache.
+     */
+    static ResourceCache& getInstance();
+
+    /**
+     * @brief Returns the texture at the given path, loading it on first use.
+     * @param path Texture file path.
+     * @return Shared texture, or nullptr if it cannot be loaded (the failure is cached too).
+     */
+    std::shared_ptr<const sf::Texture> texture(const std::string& path);
+
+    /**
+     * @brief Returns the font at the given path, loading it into memory on first use.
+     * @param path Font file path.
+     * @return Shared font, or nullptr if it cannot be loaded.
+     */
+    std::shared_ptr<const sf::Font> font(const std::string& path);
+
+    /**
+     * @brief Returns the precomputed cell rectangles of a grid-based sprite sheet.
+     * @param path Texture file path.
+     * @param cols Number of grid columns.
+     * @param rows Number of grid rows.
+     * @return Grid of cell rectangles, or nullptr if the texture cannot be loaded. Stays valid for the process.
+     */
+    const SpriteGrid* grid(const std::string& path, unsigned int cols, unsigned int rows);
+
+    /**
+     * @brief Starts decoding the given assets on worker threads and returns immediately.
+     *
+     * Images are decoded and fonts are read and parsed off the calling thread. Creating a texture needs the render
+     * context, so the upload happens on the main thread: in pollPreloads() once the image is ready, or in texture(),
+     * which waits for the worker if the texture is requested earlier. Assets already cached or in flight are skipped.
+     *
+     * @param textures Texture paths.
+     * @param fonts Font paths.
+     */
+    void preloadAsync(const std::vector<std::string>& textures, const std::vector<std::string>& fonts);
+
+    /**
+     * @brief Takes over the background loads that are done, without waiting for the others.
+     * @return Number of loads still in flight.
+     */
+    std::size_t pollPreloads();
+
+    /**
+     * @brief Drops textures and fonts that are referenced only by the cache.
+     * @return Number of released assets.
+     */
+    std::size_t purgeUnused();
+
+private:
+    /**
+     * @brief Font together with the file bytes it reads glyphs from.
+     */
+    struct FontData {
+        std::vector<char> bytes;
+        sf::Font font;
+    };
+
+    ResourceCache() = default;
+    ~ResourceCache() = default;
+
+    /**
+     * @brief Reads a font file into memory and parses it; safe to call from any thread.
+     * @param path Font file path.
+     * @return Font data, or nullptr if it cannot be loaded.
+     */
+    static std::shared_ptr<FontData> loadFont(const std::string& path);
+
+    ResourceCache(const ResourceCache&) = delete;
+    ResourceCache& operator=(const ResourceCache&) = delete;
+
+private:
+    std::unordered_map<std::string, std::shared_ptr<const sf::Texture>> textures_;
+    std::unordered_map<std::string, std::shared_ptr<FontData>> fonts_;
+    std::unordered_map<std::string, std::unique_ptr<SpriteGrid>> grids_;
+
+    std::unordered_map<std::string, std::future<std::shared_ptr<sf::Image>>> pendingImages_; ///< Decoding on workers
+    std::unordered_map<std::string, std::future<std::shared_ptr<FontData>>> pendingFonts_;   ///< Parsing on workers
+};
+
+} // namespace pacman::app
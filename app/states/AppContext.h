@@ -1,5 +1,13 @@
 #pragma once
 
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+namespace pacman::logic {
+class FrameTelemetry;
+} // namespace pacman::logic
+
 namespace pacman::app {
 
 /**
@@ -10,6 +18,30 @@ namespace pacman::app {
  */
 struct AppContext {
     int finalScore = 0;
+
+    /**
+     * @brief Whether levels show the best stored run as a translucent Pac-Man ("race your best").
+     */
+    bool raceBest = false;
+
+    /**
+     * @brief Steps the running level back by up to the given number of seconds.
+     *
+     * Installed by LevelState while a level exists (empty otherwise); returns the seconds actually rewound.
+     */
+    std::function<double(double)> rewind;
+
+    /**
+     * @brief Replay image of the seconds leading up to the most recent death (empty if none).
+     */
+    std::vector<std::byte> lastDeathReplay;
+
+    /**
+     * @brief Metrics that LevelState records every simulation step into (nullptr without --metrics).
+     *
+     * Owned by Game, which keeps it alive until the states and their simulation threads are gone.
+     */
+    pacman::logic::FrameTelemetry* telemetry = nullptr;
 };
 
-} // namespace pacman::app
\ No newline at end of file
+} // namespace pacman::app
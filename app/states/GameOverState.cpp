@@ -2,8 +2,12 @@
 
 #include "StateManager.h"
 
+#include "../resources/ResourceCache.h"
+
 #include <SFML/Graphics/RenderWindow.hpp>
+#include <SFML/Window/Keyboard.hpp>
 
+#include <algorithm>
 #include <string>
 
 namespace pacman::app {
@@ -20,6 +24,10 @@ void centerText(sf::Text& text, const sf::RenderWindow& window, float y) {
     text.setOrigin(bounds.width * 0.5f, bounds.height * 0.5f);
     text.setPosition(static_cast<float>(window.getSize().x) * 0.5f, y);
 }
+
+constexpr int kMaxReplaySpeed = 8;
+constexpr double kReplayHold = 1.0;           ///< Seconds the final frame stays visible before looping
+constexpr std::uint64_t kMaxReplayTicks = 64; ///< Per-update cap so a long frame cannot stall the loop
 } // namespace
 
 /**
@@ -32,25 +40,33 @@ void GameOverState::init(const sf::RenderWindow& window) {
     }
     initialized_ = true;
 
-    if (!font_.loadFromFile("../assets/fonts/Crackman.otf")) {
+    font_ = ResourceCache::getInstance().font(assets::MainFont);
+    if (!font_) {
         throw std::runtime_error("Missing/failed to load font: assets/fonts/Crackman.otf");
     }
 
-    title_.setFont(font_);
+    title_.setFont(*font_);
     title_.setString("GAME OVER");
     title_.setCharacterSize(64);
     title_.setFillColor(sf::Color::Red);
 
-    scoreText_.setFont(font_);
+    scoreText_.setFont(*font_);
     scoreText_.setCharacterSize(32);
     scoreText_.setFillColor(sf::Color::White);
     scoreText_.setString("Final score: " + std::to_string(manager_.ctx.finalScore));
 
-    hint_.setFont(font_);
+    hint_.setFont(*font_);
     hint_.setCharacterSize(32);
     hint_.setFillColor(sf::Color(200, 200, 200));
     hint_.setString("Press any key to return to menu");
 
+    overlay_.setFillColor(sf::Color(0, 0, 0, 150));
+
+    replayLabel_.setFont(*font_);
+    replayLabel_.setCharacterSize(24);
+    replayLabel_.setFillColor(sf::Color(200, 200, 200));
+    updateReplayLabel();
+
     const float centerY = static_cast<float>(window.getSize().y) * 0.5f;
     centerText(title_, window, centerY - 60.0f);
     centerText(scoreText_, window, centerY);
@@ -58,7 +74,80 @@ void GameOverState::init(const sf::RenderWindow& window) {
 }
 
 /**
- * @brief Handles input for leaving the game over screen and returning to the menu.
+ * @brief Builds the replay world and player from the captured death replay, if there is one.
+ *
+ * The replay world has its own factory and views; the level world below this state is not touched.
+ */
+void GameOverState::initReplay() {
+    if (replayInitialized_) {
+        return;
+    }
+    replayInitialized_ = true;
+
+    replayData_ = manager_.ctx.lastDeathReplay;
+    if (replayData_.empty()) {
+        return;
+    }
+
+    replayReader_ = std::make_unique<logic::ReplayReader>(replayData_.data(), replayData_.size());
+    logic::ReplayIndexEntry start{};
+    if (!replayReader_->isValid() || !replayReader_->findKeyframe(replayReader_->endTick(), start)) {
+        replayReader_.reset();
+        return;
+    }
+    replayStartTick_ = start.tick;
+
+    replayFactory_ = std::make_unique<ConcreteFactory>();
+    replayWorld_ = std::make_unique<logic::World>(*replayFactory_);
+    replayWorld_->loadLevel(logic::TileMap{});
+
+    replayPlayer_ = std::make_unique<logic::ReplayPlayer>(*replayWorld_, *replayReader_);
+    replayPlayer_->setLevelAdvanceHook([this] { replayFactory_->clearViews(); });
+
+    if (!replayPlayer_->seek(replayStartTick_)) {
+        replayPlayer_.reset();
+    }
+}
+
+/**
+ * @brief Refreshes the replay caption with the current playback speed.
+ */
+void GameOverState::updateReplayLabel() {
+    replayLabel_.setString("Last death  x" + std::to_string(replaySpeed_) + "  (LEFT/RIGHT: speed)");
+}
+
+/**
+ * @brief Advances the death replay at the selected speed and loops it after a short hold.
+ * @param dt Fixed timestep in seconds.
+ */
+void GameOverState::update(double dt) {
+    initReplay();
+    if (!replayPlayer_) {
+        return;
+    }
+
+    if (replayPlayer_->finished()) {
+        replayHoldTimer_ += dt;
+        if (replayHoldTimer_ >= kReplayHold) {
+            replayHoldTimer_ = 0.0;
+            replayAccumulator_ = 0.0;
+            replayPlayer_->seek(replayStartTick_);
+            replayFactory_->views().wakeAll();
+        }
+        return;
+    }
+
+    const double step = replayReader_->header().tickDt;
+    replayAccumulator_ += dt * static_cast<double>(replaySpeed_);
+
+    const auto ticks = std::min(static_cast<std::uint64_t>(replayAccumulator_ / step), kMaxReplayTicks);
+    replayAccumulator_ = std::max(0.0, replayAccumulator_ - static_cast<double>(ticks) * step);
+
+    replayPlayer_->advance(ticks);
+}
+
+/**
+ * @brief Handles input for leaving the game over screen and changing the replay speed.
  * @param event The SFML event to process.
  */
 void GameOverState::handleEvent(const sf::Event& event) {
@@ -66,17 +155,42 @@ void GameOverState::handleEvent(const sf::Event& event) {
         return;
     }
 
+    if (event.key.code == sf::Keyboard::Left || event.key.code == sf::Keyboard::Right) {
+        const bool faster = (event.key.code == sf::Keyboard::Right);
+        replaySpeed_ = std::clamp(faster ? replaySpeed_ * 2 : replaySpeed_ / 2, 1, kMaxReplaySpeed);
+        updateReplayLabel();
+        return;
+    }
+
     pop();
     pop();
     push("menu");
 }
 
 /**
- * @brief Draws the game over UI.
+ * @brief Draws the death replay (dimmed) and the game over UI.
  * @param window The render window to draw to.
  */
 void GameOverState::draw(sf::RenderWindow& window) {
     init(window);
+
+    if (replayPlayer_) {
+        // The replay runs on its own accumulator (and speed), so it supplies its own interpolation factor.
+        const double step = replayReader_->header().tickDt;
+        const bool playing = !replayPlayer_->finished() && step > 0.0;
+        View::setInterpolationAlpha(playing ? static_cast<float>(replayAccumulator_ / step) : 1.0f);
+
+        replayFactory_->setWindow(window);
+        replayFactory_->views().drawAll(window);
+
+        const auto size = window.getSize();
+        overlay_.setSize(sf::Vector2f{static_cast<float>(size.x), static_cast<float>(size.y)});
+        window.draw(overlay_);
+
+        centerText(replayLabel_, window, static_cast<float>(size.y) - 40.0f);
+        window.draw(replayLabel_);
+    }
+
     window.draw(title_);
     window.draw(scoreText_);
     window.draw(hint_);
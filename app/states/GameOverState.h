@@ -2,13 +2,27 @@
 
 #include "State.h"
 
+#include "../factory/ConcreteFactory.h"
+#include "../logic/replay/ReplayPlayer.h"
+#include "../logic/replay/ReplayReader.h"
+#include "../logic/world/World.h"
+
 #include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/RectangleShape.hpp>
 #include <SFML/Graphics/Text.hpp>
 
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
 namespace pacman::app {
 
 /**
  * @brief State shown when the player loses; displays final score and returns to menu on key press.
+ *
+ * Behind the text, the seconds leading up to the final death are re-simulated in a separate World from the
+ * replay image captured by LevelState, looping at an adjustable speed (1x to 8x).
  */
 class GameOverState : public State {
 public:
@@ -21,7 +35,13 @@ public:
     void handleEvent(const sf::Event& event) override;
 
     /**
-     * @brief Draws the game over UI.
+     * @brief Advances the death replay playback.
+     * @param dt Fixed timestep in seconds.
+     */
+    void update(double dt) override;
+
+    /**
+     * @brief Draws the death replay (dimmed) and the game over UI.
      * @param window The render window to draw to.
      */
     void draw(sf::RenderWindow& window) override;
@@ -33,12 +53,37 @@ private:
      */
     void init(const sf::RenderWindow& window);
 
+    /**
+     * @brief Builds the replay world and player from the captured death replay, if there is one.
+     */
+    void initReplay();
+
+    /**
+     * @brief Refreshes the replay caption with the current playback speed.
+     */
+    void updateReplayLabel();
+
 private:
-    sf::Font font_;
+    std::shared_ptr<const sf::Font> font_;
     sf::Text title_;
     sf::Text scoreText_;
     sf::Text hint_;
     bool initialized_ = false;
+
+    sf::RectangleShape overlay_;
+    sf::Text replayLabel_;
+
+    std::vector<std::byte> replayData_;
+    std::unique_ptr<ConcreteFactory> replayFactory_;
+    std::unique_ptr<logic::World> replayWorld_;
+    std::unique_ptr<logic::ReplayReader> replayReader_;
+    std::unique_ptr<logic::ReplayPlayer> replayPlayer_;
+    bool replayInitialized_ = false;
+
+    std::uint64_t replayStartTick_{0};
+    double replayAccumulator_{0.0};
+    double replayHoldTimer_{0.0};
+    int replaySpeed_{1};
 };
 
 } // namespace pacman::app
\ No newline at end of file
@@ -2,35 +2,108 @@
 
 #include "StateManager.h"
 
+#include "../resources/ResourceCache.h"
+
 #include "../factory/ConcreteFactory.h"
+#include "../logic/entities/PacMan.h"
+#include "../logic/utils/FrameTelemetry.h"
+#include "../logic/utils/LatencyTracker.h"
+#include "../logic/utils/Profiler.h"
+#include "../logic/utils/StartupTimeline.h"
 #include "../logic/world/World.h"
+#include "../views/View.h"
 
 #include <SFML/Graphics/RenderWindow.hpp>
 #include <SFML/Window/Keyboard.hpp>
 
+#include <chrono>
+#include <filesystem>
+#include <iterator>
+#include <stdexcept>
+#include <system_error>
+#include <utility>
+
 namespace pacman::app {
 
+namespace {
+constexpr const char* kLastReplayPath = "assets/data/last.replay";
+constexpr const char* kBestReplayPath = "assets/data/best.replay";
+constexpr std::uint8_t kBestRunAlpha = 110;
+
+/**
+ * @brief Returns the steady clock time in nanoseconds, as stored in RenderSnapshot::publishedNs.
+ * @return Nanoseconds since the steady clock's epoch.
+ */
+std::int64_t steadyNowNs() {
+    const auto now = std::chrono::steady_clock::now().time_since_epoch();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(now).count();
+}
+} // namespace
+
 /**
- * @brief Constructs the level gameplay state, sets up the world, factory, HUD, and initial delay.
+ * @brief Constructs the level gameplay state, sets up both worlds, factories, HUD, and initial delay.
+ *
+ * The simulation thread itself is started by the first update(), once the fixed timestep is known.
+ *
  * @param manager Reference to the central StateManager.
  */
 LevelState::LevelState(StateManager& manager) : State(manager), tileMap_() {
-    factory_ = std::make_unique<ConcreteFactory>();
-    factory_->setScoreObserver(&score_);
+    simFactory_.setScoreObserver(&score_);
+    simWorld_ = std::make_unique<pacman::logic::World>(simFactory_);
+    simWorld_->loadLevel(tileMap_);
 
+    factory_ = std::make_unique<ConcreteFactory>();
     world_ = std::make_unique<pacman::logic::World>(*factory_);
     world_->loadLevel(tileMap_);
 
-    if (!hudFont_.loadFromFile("../assets/fonts/Crackman.otf")) {
+    hudFont_ = ResourceCache::getInstance().font(assets::MainFont);
+    if (!hudFont_) {
         throw std::runtime_error("Missing/failed to load font: assets/fonts/Crackman.otf");
     }
-    hud_ = std::make_unique<Hud>(score_, *world_, hudFont_);
+    hud_ = std::make_unique<Hud>(*hudFont_);
+#if defined(PACMAN_PROFILE)
+    statsOverlay_ = std::make_unique<StatsOverlay>(*hudFont_);
+#endif
 
     startDelayTimer_ = startDelay_;
+    publishSnapshot();
+
+    manager_.ctx.rewind = [this](double seconds) { return rewind(seconds); };
+    manager_.ctx.lastDeathReplay.clear();
+    deathReplay_.reserve(instantReplay_.maxCaptureBytes()); // capture() runs inside a tick and must not allocate
+
+    if (manager_.ctx.raceBest) {
+        bestRun_ = std::make_unique<pacman::logic::ReplayTrackStream>(kBestReplayPath);
+        if (bestRun_->isOpen()) {
+            bestPacMan_ = std::make_shared<pacman::logic::PacMan>(pacman::logic::Rect{});
+            bestPacMan_->active = false;
+
+            bestView_ = std::make_unique<PacManView>(bestPacMan_);
+            bestView_->setOpacity(kBestRunAlpha);
+            bestPacMan_->attach(bestView_.get());
+        } else {
+            bestRun_.reset();
+        }
+    }
+
+    pacman::logic::StartupTimeline::getInstance().mark("level created");
+}
+
+/**
+ * @brief Stops the simulation thread and removes the rewind hook from the shared context.
+ */
+LevelState::~LevelState() {
+    sim_.reset();
+    manager_.ctx.rewind = nullptr;
 }
 
 /**
  * @brief Handles user input and translates key presses into gameplay actions.
+ *
+ * Direction keys are stamped and queued for the simulation thread, which applies each one at the first tick
+ * scheduled after it was polled. The simulation is paused before the pause menu is shown, so it can rewind the
+ * level safely.
+ *
  * @param event The SFML event to process.
  */
 void LevelState::handleEvent(const sf::Event& event) {
@@ -40,76 +113,337 @@ void LevelState::handleEvent(const sf::Event& event) {
 
     using sf::Keyboard;
 
+    pacman::logic::Direction direction = pacman::logic::Direction::None;
     switch (event.key.code) {
     case Keyboard::Up:
-        desiredDirection_ = pacman::logic::Direction::Up;
+        direction = pacman::logic::Direction::Up;
         break;
     case Keyboard::Down:
-        desiredDirection_ = pacman::logic::Direction::Down;
+        direction = pacman::logic::Direction::Down;
         break;
     case Keyboard::Left:
-        desiredDirection_ = pacman::logic::Direction::Left;
+        direction = pacman::logic::Direction::Left;
         break;
     case Keyboard::Right:
-        desiredDirection_ = pacman::logic::Direction::Right;
+        direction = pacman::logic::Direction::Right;
         break;
     case Keyboard::Escape:
+        if (sim_) {
+            sim_->pause();
+        }
         push("paused");
-        break;
+        return;
     default:
-        break;
+        return;
     }
+
+    const std::int64_t now = steadyNowNs();
+    const std::uint32_t latencyId = pacman::logic::LatencyTracker::getInstance().pressed(now);
+    inputs_.tryPush(TimedInput{direction, now, latencyId});
 }
 
 /**
- * @brief Updates the gameplay simulation using a fixed timestep from the game loop.
+ * @brief Keeps the simulation thread running and handles the transitions it requested.
+ *
+ * Called with the game loop's fixed timestep, which the simulation thread adopts as its tick. While another
+ * state is on top this is not called, so the simulation stays paused until the level is shown again.
+ *
  * @param dt Fixed timestep in seconds.
  */
 void LevelState::update(double dt) {
-    if (!world_) {
+    if (!simWorld_) {
         return;
     }
 
+    if (!sim_) {
+        // The rewind window is a span of time, so its frame count follows the tick rate (--tick-rate).
+        if (dt != tickDt_) {
+            tickDt_ = dt;
+            rewind_ = pacman::logic::RewindBuffer::forTickRate(dt);
+        }
+        sim_ = std::make_unique<pacman::logic::SimulationThread>(
+            dt, [this](pacman::logic::SimulationThread::Clock::time_point deadline) { return timedStep(deadline); });
+    }
+
+    switch (pending_.load()) {
+    case Pending::GameOver:
+        sim_->pause();
+        pending_ = Pending::None;
+        finishGame();
+        return;
+    case Pending::LevelCleared:
+        sim_->pause();
+        pending_ = Pending::None;
+        clearLevel();
+        return;
+    case Pending::None:
+        break;
+    }
+
+    sim_->resume();
+}
+
+/**
+ * @brief Runs step() and records its time and the ticks dropped since the previous step, if metrics are kept.
+ * @param deadline Scheduled time of this tick.
+ * @return Result of step().
+ */
+bool LevelState::timedStep(pacman::logic::SimulationThread::Clock::time_point deadline) {
+    auto* telemetry = manager_.ctx.telemetry;
+    if (!telemetry) {
+        return step(deadline);
+    }
+
+    const auto start = pacman::logic::SimulationThread::Clock::now();
+    const bool keepRunning = step(deadline);
+
+    pacman::logic::FrameTelemetry::SimStep sample;
+    sample.seconds = std::chrono::duration<double>(pacman::logic::SimulationThread::Clock::now() - start).count();
+    const std::uint64_t dropped = sim_->droppedTicks();
+    sample.droppedTicks = dropped - std::exchange(reportedDroppedTicks_, dropped);
+    telemetry->recordSimStep(sample);
+
+    return keepRunning;
+}
+
+/**
+ * @brief Advances the simulated world by one tick (runs on the simulation thread).
+ *
+ * Records the replays and rewind history, publishes the new render snapshot, and pauses the thread when the
+ * game is over or the level is cleared so the main thread can take over. The whole step is the profiler's update
+ * phase.
+ *
+ * @param deadline Scheduled time of this tick.
+ * @return False to pause the simulation thread.
+ */
+bool LevelState::step(pacman::logic::SimulationThread::Clock::time_point deadline) {
+    PACMAN_PROFILE_SCOPE(pacman::logic::ProfilePhase::Update);
+
+    if (pending_.load() != Pending::None) {
+        return false;
+    }
+
+    takeInput(std::chrono::duration_cast<std::chrono::nanoseconds>(deadline.time_since_epoch()).count());
+
     if (startDelayTimer_ > 0.0) {
-        startDelayTimer_ -= dt;
+        startDelayTimer_ -= tickDt_;
         if (startDelayTimer_ < 0.0) {
             startDelayTimer_ = 0.0;
         }
 
-        world_->tickAnimationsOnly();
+        simWorld_->tickAnimationsOnly();
+        publishSnapshot();
+        return true;
+    }
+
+    auto& latency = pacman::logic::LatencyTracker::getInstance();
+
+    const pacman::logic::Direction direction = desiredDirection_;
+    if (direction != pacman::logic::Direction::None) {
+        simWorld_->setPacManDirection(direction);
+        latency.reached(awaitingTurn_, pacman::logic::LatencyStage::Applied);
+    }
+
+    if (simWorld_->isGameOver()) {
+        pending_ = Pending::GameOver;
+        return false;
+    }
+
+    if (!replay_) {
+        replay_ = std::make_unique<pacman::logic::ReplayWriter>(kLastReplayPath, tickDt_);
+    }
+    replay_->recordTick(*simWorld_, direction);
+    instantReplay_.recordTick(*simWorld_, direction);
+
+    const int livesBefore = simWorld_->lives();
+    simWorld_->update(tickDt_);
+
+    if (simWorld_->lives() < livesBefore) {
+        instantReplay_.capture(tickDt_, deathReplay_);
+    }
+
+    const pacman::logic::PacMan* pac = simWorld_->pacMan();
+    if (awaitingTurn_ != 0 && pac && pac->direction() == direction) {
+        latency.reached(awaitingTurn_, pacman::logic::LatencyStage::Turned);
+        turnedInput_ = std::exchange(awaitingTurn_, 0u);
+    }
+
+    if (simWorld_->isLevelCleared()) {
+        pending_ = Pending::LevelCleared;
+        return false;
+    }
+
+    rewind_.record(*simWorld_, score_);
+    publishSnapshot();
+    return true;
+}
+
+/**
+ * @brief Takes the oldest queued key press that happened before the given tick time.
+ *
+ * Presses polled after the tick's scheduled time stay queued for a later tick, so a late-running step does not
+ * apply them early. At most one press is taken per tick, so quick successive presses each reach the world.
+ *
+ * @param deadlineNs Scheduled time of the current tick in steady clock nanoseconds.
+ */
+void LevelState::takeInput(std::int64_t deadlineNs) {
+    const TimedInput* input = inputs_.peek();
+    if (!input || input->timeNs > deadlineNs) {
         return;
     }
 
-    if (desiredDirection_ != pacman::logic::Direction::None) {
-        world_->setPacManDirection(desiredDirection_);
+    desiredDirection_ = input->direction;
+    awaitingTurn_ = input->latencyId;
+    inputs_.pop();
+}
+
+/**
+ * @brief Captures the simulated world and score and hands them to the render thread.
+ *
+ * Called from the simulation thread, or from the main thread while the simulation is paused.
+ */
+void LevelState::publishSnapshot() {
+    auto& snapshot = snapshots_.writeBuffer();
+    if (!simWorld_->captureRenderSnapshot(snapshot)) {
+        return;
     }
 
-    if (world_->isGameOver()) {
-        const int finalScore = score_.value();
-        manager_.ctx.finalScore = finalScore;
+    snapshot.score = score_.value();
+    snapshot.turnedInput = turnedInput_;
+    snapshot.publishedNs = steadyNowNs();
+    snapshots_.publish();
+}
+
+/**
+ * @brief Saves highscores and the replays of the finished game, then shows the game over screen.
+ *
+ * A new top score also becomes the best replay, unless the game was rewound.
+ */
+void LevelState::finishGame() {
+    const int finalScore = score_.value();
+    manager_.ctx.finalScore = finalScore;
+    manager_.ctx.lastDeathReplay = deathReplay_;
+
+    auto highs = pacman::logic::Score::loadHighscores("assets/data/highscores.txt");
+    const bool newBest = highs.empty() || finalScore > highs.front();
+    highs = pacman::logic::Score::updateHighscores(highs, finalScore);
+    pacman::logic::Score::saveHighscores("assets/data/highscores.txt", highs);
+
+    if (replay_) {
+        replay_->finish();
+
+        // After a rewind the file only holds the game from the restored tick on and would not reproduce the score.
+        if (newBest && !rewound_) {
+            std::error_code ec;
+            std::filesystem::copy_file(kLastReplayPath, kBestReplayPath,
+                                       std::filesystem::copy_options::overwrite_existing, ec);
+        }
+    }
+
+    push("gameover");
+}
+
+/**
+ * @brief Loads the next level in both worlds and shows the victory screen.
+ *
+ * The views are rebuilt by the render world's factory; the new level is published right away so the stale
+ * snapshot of the cleared level is never applied to them. The rewind history starts over with the new level, so
+ * rewinding cannot bring back the cleared level or award its bonus twice.
+ */
+void LevelState::clearLevel() {
+    factory_->clearViews();
+    world_->advanceLevel();
+    simWorld_->advanceLevel();
+
+    score_.add(1000);
+    desiredDirection_ = pacman::logic::Direction::None;
+    awaitingTurn_ = 0;
+    inputs_.clear();
+    startDelayTimer_ = startDelay_;
+
+    rewind_.clear();
+    rewind_.record(*simWorld_, score_);
+    publishSnapshot();
+    push("victory");
+}
 
-        auto highs = pacman::logic::Score::loadHighscores("assets/data/highscores.txt");
-        highs = pacman::logic::Score::updateHighscores(highs, finalScore);
-        pacman::logic::Score::saveHighscores("assets/data/highscores.txt", highs);
+/**
+ * @brief Moves the best-run Pac-Man to its recorded position for the given tick.
+ *
+ * The track is streamed from disk as the level progresses; the puppet is hidden where the best run has no
+ * sample (before its recording started or after it ended). Its previous bounds are kept so it is interpolated
+ * like the live actors.
+ *
+ * @param tick World tick of the snapshot being drawn.
+ */
+void LevelState::updateBestRun(std::uint64_t tick) {
+    if (!bestRun_) {
+        return;
+    }
 
-        push("gameover");
+    pacman::logic::TrackPayload sample{};
+    if (!bestRun_->sampleAt(tick, sample)) {
+        bestPacMan_->active = false;
         return;
     }
 
-    world_->update(dt);
+    const bool wasActive = bestPacMan_->active;
+    bestPacMan_->storePreviousBounds();
 
-    if (world_->isLevelCleared()) {
-        factory_->views().clear();
-        world_->advanceLevel();
-        score_.add(1000);
-        desiredDirection_ = pacman::logic::Direction::None;
-        startDelayTimer_ = startDelay_;
-        push("victory");
+    const pacman::logic::Rect bounds{sample.x, sample.y, sample.w, sample.h};
+    const auto direction = static_cast<pacman::logic::Direction>(sample.direction);
+    bestPacMan_->restore(bounds, direction, direction, bestPacMan_->speed());
+    bestPacMan_->active = sample.active != 0;
+
+    if (!wasActive) {
+        bestPacMan_->storePreviousBounds();
     }
 }
 
 /**
- * @brief Draws the level views and HUD for the current frame.
+ * @brief Steps the world and score back in time using the rewind history.
+ *
+ * Runs on the main thread with the simulation paused. The buffered direction and queued key presses are dropped
+ * so Pac-Man continues with the restored one, and replay recording restarts from the restored tick because a
+ * replay cannot go back in time. That replay no longer covers the whole game, so the session can no longer become
+ * the best replay. The restored state is published right away; draw() wakes parked views when pickups come back.
+ *
+ * @param seconds Simulated seconds to go back.
+ * @return Seconds actually rewound.
+ */
+double LevelState::rewind(double seconds) {
+    if (!simWorld_ || seconds <= 0.0) {
+        return 0.0;
+    }
+
+    if (sim_) {
+        sim_->pause();
+    }
+
+    const auto frames = static_cast<std::size_t>(seconds / tickDt_ + 0.5);
+    const std::size_t stepped = rewind_.stepBack(frames, *simWorld_, score_);
+    if (stepped == 0) {
+        return 0.0;
+    }
+
+    desiredDirection_ = pacman::logic::Direction::None;
+    awaitingTurn_ = 0;
+    inputs_.clear();
+    replay_.reset();
+    rewound_ = true;
+    publishSnapshot();
+
+    return static_cast<double>(stepped) * tickDt_;
+}
+
+/**
+ * @brief Applies the latest render snapshot and draws the level views and HUD for the current frame.
+ *
+ * Views are interpolated between the snapshot's previous and current actor bounds by the time elapsed since it
+ * was published, so motion stays smooth regardless of how the simulation and display rates line up.
+ *
+ * In PACMAN_PROFILE builds the simulation counters carried by the snapshot are shown while the profiler is on.
+ *
  * @param window The render window to draw to.
  */
 void LevelState::draw(sf::RenderWindow& window) {
@@ -117,14 +451,42 @@ void LevelState::draw(sf::RenderWindow& window) {
     windowWidth_ = size.x;
     windowHeight_ = size.y;
 
-    if (factory_) {
-        factory_->setWindow(window);
-        factory_->views().drawAll(window);
+    if (snapshots_.update()) {
+        const auto& fresh = snapshots_.readBuffer();
+        world_->applyRenderSnapshot(fresh);
+
+        bool regained = false;
+        for (std::size_t i = 0; i < std::size(appliedPickups_); ++i) {
+            regained = regained || (fresh.pickups[i] & ~appliedPickups_[i]) != 0;
+            appliedPickups_[i] = fresh.pickups[i];
+        }
+        if (regained) {
+            factory_->views().wakeAll();
+        }
+
+        updateBestRun(fresh.tick);
+        pacman::logic::LatencyTracker::getInstance().drawn(fresh.turnedInput);
     }
 
-    if (hud_) {
-        hud_->draw(window);
+    const auto& snapshot = snapshots_.readBuffer();
+    const double sincePublished = static_cast<double>(steadyNowNs() - snapshot.publishedNs) * 1e-9;
+    View::setInterpolationAlpha(static_cast<float>(sincePublished / tickDt_));
+
+    factory_->setWindow(window);
+    factory_->views().drawAll(window);
+
+    if (bestView_) {
+        bestView_->draw(window, overlayBatch_);
+        overlayBatch_.flush(window);
+    }
+
+    hud_->draw(window, snapshot);
+
+#if defined(PACMAN_PROFILE)
+    if (pacman::logic::Profiler::getInstance().enabled()) {
+        statsOverlay_->draw(window, snapshot.stats);
     }
+#endif
 }
 
-} // namespace pacman::app
\ No newline at end of file
+} // namespace pacman::app
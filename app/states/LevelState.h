@@ -4,19 +4,40 @@
 
 #include "../factory/ConcreteFactory.h"
 #include "../logic/entities/Direction.h"
+#include "../logic/factory/ModelFactory.h"
+#include "../logic/replay/InstantReplay.h"
+#include "../logic/replay/ReplayTrackStream.h"
+#include "../logic/replay/ReplayWriter.h"
+#include "../logic/replay/RewindBuffer.h"
 #include "../logic/score/Score.h"
+#include "../logic/utils/SimulationThread.h"
+#include "../logic/utils/SpscQueue.h"
+#include "../logic/utils/TripleBuffer.h"
+#include "../logic/world/RenderSnapshot.h"
 #include "../logic/world/TileMap.h"
 #include "../logic/world/World.h"
 #include "../ui/Hud.h"
+#include "../ui/StatsOverlay.h"
+#include "../views/PacManView.h"
+#include "../views/SpriteBatch.h"
 
 #include <SFML/Graphics/Font.hpp>
 
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <vector>
 
 namespace pacman::app {
 
 /**
  * @brief Gameplay state responsible for running a level: input, world updates, and rendering.
+ *
+ * The level is simulated on a SimulationThread in its own world (plain models, score observer attached) and
+ * every step is published as a RenderSnapshot through a triple buffer. The render thread applies the latest
+ * snapshot to a second world whose models only feed the views, so drawing never waits for the simulation.
+ * Transitions (game over, level cleared) and rewinding run on the main thread while the simulation is paused.
  */
 class LevelState : public State {
 public:
@@ -26,6 +47,11 @@ public:
      */
     explicit LevelState(StateManager& manager);
 
+    /**
+     * @brief Stops the simulation thread and removes the rewind hook from the shared context.
+     */
+    ~LevelState() override;
+
     /**
      * @brief Translates SFML events into player intentions (movement, pause).
      * @param event The SFML event to process.
@@ -33,32 +59,129 @@ public:
     void handleEvent(const sf::Event& event) override;
 
     /**
-     * @brief Advances world simulation and handles transitions such as victory/game over and level clears.
-     * @param dt Fixed timestep in seconds.
+     * @brief Starts or resumes the simulation thread and handles transitions such as game over and level clears.
+     * @param dt Fixed timestep in seconds (the simulation thread's tick).
      */
     void update(double dt) override;
 
     /**
-     * @brief Draws all views created for the level and the HUD.
+     * @brief Applies the latest render snapshot and draws all views created for the level and the HUD.
      * @param window The render window to draw to.
      */
     void draw(sf::RenderWindow& window) override;
 
 private:
-    std::unique_ptr<logic::World> world_;
+    /**
+     * @brief Transition requested by the simulation thread, handled on the main thread.
+     */
+    enum class Pending : std::uint8_t { None, GameOver, LevelCleared };
+
+    /**
+     * @brief Direction key press stamped with the steady clock time it was polled at.
+     */
+    struct TimedInput {
+        logic::Direction direction{logic::Direction::None};
+        std::int64_t timeNs{0};
+        std::uint32_t latencyId{0}; ///< Id from LatencyTracker::pressed()
+    };
+
+    /**
+     * @brief Runs step() and records it in the metrics of the shared context, if any (simulation thread).
+     * @param deadline Scheduled time of this tick.
+     * @return Result of step().
+     */
+    bool timedStep(logic::SimulationThread::Clock::time_point deadline);
+
+    /**
+     * @brief Advances the simulated world by one tick (runs on the simulation thread).
+     * @param deadline Scheduled time of this tick.
+     * @return False to pause the simulation thread.
+     */
+    bool step(logic::SimulationThread::Clock::time_point deadline);
+
+    /**
+     * @brief Takes the oldest queued key press that happened before the given tick time (simulation thread).
+     * @param deadlineNs Scheduled time of the current tick in steady clock nanoseconds.
+     */
+    void takeInput(std::int64_t deadlineNs);
+
+    /**
+     * @brief Captures the simulated world and score and hands them to the render thread.
+     */
+    void publishSnapshot();
+
+    /**
+     * @brief Saves highscores and the replays of the finished game, then shows the game over screen.
+     */
+    void finishGame();
+
+    /**
+     * @brief Loads the next level in both worlds and shows the victory screen.
+     */
+    void clearLevel();
+
+    /**
+     * @brief Steps the world and score back in time using the rewind history.
+     * @param seconds Simulated seconds to go back.
+     * @return Seconds actually rewound.
+     */
+    double rewind(double seconds);
+
+    /**
+     * @brief Moves the best-run Pac-Man to its recorded position for the given tick.
+     * @param tick World tick of the snapshot being drawn.
+     */
+    void updateBestRun(std::uint64_t tick);
+
+private:
     logic::TileMap tileMap_;
+
+    logic::ModelFactory simFactory_;
+    std::unique_ptr<logic::World> simWorld_; ///< Authoritative world, stepped on the simulation thread
+
     std::unique_ptr<ConcreteFactory> factory_;
-    logic::Direction desiredDirection_{logic::Direction::None};
+    std::unique_ptr<logic::World> world_; ///< Render-side mirror of simWorld_, only fed snapshots
+
+    logic::SpscQueue<TimedInput, 64> inputs_;                   ///< Filled by handleEvent(), drained per tick
+    logic::Direction desiredDirection_{logic::Direction::None}; ///< Owned by the simulation thread
+
+    std::uint32_t awaitingTurn_{0};         ///< Latency id of desiredDirection_ until Pac-Man turns (simulation thread)
+    std::uint32_t turnedInput_{0};          ///< Latency id of the last press that turned Pac-Man (simulation thread)
+    std::uint64_t reportedDroppedTicks_{0}; ///< SimulationThread::droppedTicks() already recorded (simulation thread)
+
+    std::atomic<Pending> pending_{Pending::None};
 
     double startDelay_ = 1.0;
     double startDelayTimer_ = 0.0;
 
     logic::Score score_;
-    sf::Font hudFont_;
+    std::shared_ptr<const sf::Font> hudFont_;
     std::unique_ptr<Hud> hud_;
+#if defined(PACMAN_PROFILE)
+    std::unique_ptr<StatsOverlay> statsOverlay_; ///< Drawn with the profiler overlay (F4)
+#endif
+
+    std::unique_ptr<logic::ReplayWriter> replay_; ///< Records the session to assets/data/last.replay off-thread
+    bool rewound_{false};                         ///< A rewind restarted replay_, so it misses the start of the game
+    logic::InstantReplay instantReplay_;          ///< Last few seconds of inputs for the death replay
+    std::vector<std::byte> deathReplay_;          ///< Captured on the simulation thread, handed over at game over
+    double tickDt_{1.0 / 60.0};                   ///< Simulation tick, taken from the first update()
+
+    /// Last 30 s of frames for the pause menu rewind, resized by update() if the tick differs from the default.
+    logic::RewindBuffer rewind_{logic::RewindBuffer::forTickRate(tickDt_)};
+
+    logic::TripleBuffer<logic::RenderSnapshot> snapshots_;
+    std::uint64_t appliedPickups_[logic::WorldState::MaxPickups / 64]{}; ///< Pickup bits of the applied snapshot
+
+    std::unique_ptr<logic::ReplayTrackStream> bestRun_; ///< Track of assets/data/best.replay (race-your-best)
+    std::shared_ptr<logic::PacMan> bestPacMan_;         ///< Puppet model driven by bestRun_, not part of the world
+    std::unique_ptr<PacManView> bestView_;
+    SpriteBatch overlayBatch_; ///< Draws the best-run Pac-Man above the level views
 
     unsigned int windowWidth_{800};
     unsigned int windowHeight_{600};
+
+    std::unique_ptr<logic::SimulationThread> sim_; ///< Declared last: stopped before anything it steps is destroyed
 };
 
 } // namespace pacman::app
\ No newline at end of file
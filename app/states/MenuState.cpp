@@ -1,6 +1,11 @@
 #include "MenuState.h"
 
+#include "StateManager.h"
+
+#include "../resources/ResourceCache.h"
+
 #include "score/Score.h"
+#include "utils/StartupTimeline.h"
 
 #include <SFML/Graphics/RectangleShape.hpp>
 #include <SFML/Graphics/Text.hpp>
@@ -78,21 +83,31 @@ void centerTextOrigin(sf::Text& text) {
 
 /**
  * @brief Constructs the menu state, loads resources, and reads highscores.
+ *
+ * The font is normally parsed in the background by then (see ResourceCache::preloadAsync()).
  * @param manager Reference to the central StateManager.
  */
 MenuState::MenuState(StateManager& manager) : State(manager) {
-    if (!font_.loadFromFile("../assets/fonts/Crackman.otf")) {
+    font_ = ResourceCache::getInstance().font(assets::MainFont);
+    if (!font_) {
         throw std::runtime_error("Missing/failed to load font: assets/fonts/Crackman.otf");
     }
     highscores_ = pacman::logic::Score::loadHighscores(highscorePath_);
+    pacman::logic::StartupTimeline::getInstance().mark("highscores read");
 }
 
 /**
- * @brief Handles keyboard and mouse interactions for starting the game.
+ * @brief Handles keyboard and mouse interactions for starting the game and toggling race-your-best.
  * @param event The SFML event to process.
  */
 void MenuState::handleEvent(const sf::Event& event) {
+    if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::R) {
+        manager_.ctx.raceBest = !manager_.ctx.raceBest;
+        return;
+    }
+
     if (event.type == sf::Event::KeyPressed) {
+        pacman::logic::StartupTimeline::getInstance().mark("level requested");
         push("level");
         return;
     }
@@ -106,19 +121,20 @@ void MenuState::handleEvent(const sf::Event& event) {
     const float my = static_cast<float>(event.mouseButton.y);
 
     if (bounds.contains(mx, my)) {
+        pacman::logic::StartupTimeline::getInstance().mark("level requested");
         push("level");
     }
 }
 
 /**
- * @brief Draws the menu: title, highscores, and the play button.
+ * @brief Draws the menu: title, highscores, the play button, and the race-your-best toggle.
  * @param window The render window to draw to.
  */
 void MenuState::draw(sf::RenderWindow& window) {
     updateWindowSize(window, windowWidth_, windowHeight_);
 
     sf::Text title;
-    title.setFont(font_);
+    title.setFont(*font_);
     title.setString("Pac-Man");
     title.setCharacterSize(64);
     title.setFillColor(sf::Color::Yellow);
@@ -127,7 +143,7 @@ void MenuState::draw(sf::RenderWindow& window) {
     window.draw(title);
 
     sf::Text scoreText;
-    scoreText.setFont(font_);
+    scoreText.setFont(*font_);
     scoreText.setCharacterSize(24);
     scoreText.setFillColor(sf::Color::White);
 
@@ -154,13 +170,22 @@ void MenuState::draw(sf::RenderWindow& window) {
     window.draw(button);
 
     sf::Text playText;
-    playText.setFont(font_);
+    playText.setFont(*font_);
     playText.setString("Play");
     playText.setCharacterSize(28);
     playText.setFillColor(sf::Color::White);
     centerTextOrigin(playText);
     playText.setPosition(centerX, centerY);
     window.draw(playText);
+
+    sf::Text raceText;
+    raceText.setFont(*font_);
+    raceText.setString(manager_.ctx.raceBest ? "R: race your best [ON]" : "R: race your best [OFF]");
+    raceText.setCharacterSize(20);
+    raceText.setFillColor(sf::Color(200, 200, 200));
+    centerTextOrigin(raceText);
+    raceText.setPosition(centerX, centerY + kButtonHeight);
+    window.draw(raceText);
 }
 
 } // namespace pacman::app
\ No newline at end of file
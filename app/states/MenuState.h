@@ -4,6 +4,7 @@
 
 #include <SFML/Graphics/Font.hpp>
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -21,7 +22,7 @@ public:
     explicit MenuState(StateManager& manager);
 
     /**
-     * @brief Handles keyboard and mouse input for starting the level.
+     * @brief Handles keyboard and mouse input for starting the level and toggling race-your-best (R).
      * @param event The SFML event to process.
      */
     void handleEvent(const sf::Event& event) override;
@@ -33,7 +34,7 @@ public:
     void draw(sf::RenderWindow& window) override;
 
 private:
-    sf::Font font_;
+    std::shared_ptr<const sf::Font> font_;
     unsigned int windowWidth_{800};
     unsigned int windowHeight_{600};
 
@@ -1,10 +1,16 @@
 #include "PausedState.h"
 
+#include "StateManager.h"
+
+#include "../resources/ResourceCache.h"
+
 #include <SFML/Graphics/RenderWindow.hpp>
 #include <SFML/Window/Keyboard.hpp>
 #include <SFML/Window/Mouse.hpp>
 
 #include <cstddef>
+#include <iomanip>
+#include <sstream>
 
 namespace pacman::app {
 
@@ -12,6 +18,7 @@ namespace {
 constexpr float kButtonWidth = 260.0f;
 constexpr float kButtonHeight = 64.0f;
 constexpr float kButtonGap = 18.0f;
+constexpr double kRewindStep = 1.0; ///< Seconds rewound per click / key press
 
 /**
  * @brief Centers an SFML text object's origin using its local bounds.
@@ -33,11 +40,12 @@ void PausedState::init(const sf::RenderWindow& window) {
     }
     initialized_ = true;
 
-    if (!font_.loadFromFile("../assets/fonts/Crackman.otf")) {
+    font_ = ResourceCache::getInstance().font(assets::MainFont);
+    if (!font_) {
         throw std::runtime_error("Missing/failed to load font: assets/fonts/Crackman.otf");
     }
 
-    title_.setFont(font_);
+    title_.setFont(*font_);
     title_.setString("PAUSED");
     title_.setCharacterSize(72);
     title_.setFillColor(sf::Color::Yellow);
@@ -46,16 +54,20 @@ void PausedState::init(const sf::RenderWindow& window) {
 
     overlay_.setFillColor(sf::Color(0, 0, 0, 170));
 
-    buttons_.resize(3);
+    rewindLabel_.setFont(*font_);
+    rewindLabel_.setCharacterSize(24);
+    rewindLabel_.setFillColor(sf::Color::White);
+
+    buttons_.resize(4);
 
-    const char* labels[3] = {"RESUME", "RESTART", "MENU"};
+    const char* labels[4] = {"RESUME", "REWIND", "RESTART", "MENU"};
     for (std::size_t i = 0; i < buttons_.size(); ++i) {
         buttons_[i].rect.setSize({kButtonWidth, kButtonHeight});
         buttons_[i].rect.setFillColor(sf::Color(30, 30, 30, 220));
         buttons_[i].rect.setOutlineThickness(3.0f);
         buttons_[i].rect.setOutlineColor(sf::Color::White);
 
-        buttons_[i].label.setFont(font_);
+        buttons_[i].label.setFont(*font_);
         buttons_[i].label.setString(labels[i]);
         buttons_[i].label.setCharacterSize(32);
         buttons_[i].label.setFillColor(sf::Color::White);
@@ -75,6 +87,9 @@ void PausedState::layout(const sf::RenderWindow& window) {
     centerTextOrigin(title_);
     title_.setPosition(static_cast<float>(ws.x) * 0.5f, static_cast<float>(ws.y) * 0.25f);
 
+    centerTextOrigin(rewindLabel_);
+    rewindLabel_.setPosition(static_cast<float>(ws.x) * 0.5f, static_cast<float>(ws.y) * 0.36f);
+
     const float centerX = static_cast<float>(ws.x) * 0.5f;
     const float startY = static_cast<float>(ws.y) * 0.45f;
 
@@ -112,7 +127,25 @@ bool PausedState::hitButton(std::size_t index, float mx, float my) const {
 }
 
 /**
- * @brief Handles pause menu input: resume, restart, or return to menu.
+ * @brief Rewinds the paused level by one step and updates the rewind label, keeping it centered.
+ *
+ * Does nothing if no level is running or the rewind history is exhausted.
+ */
+void PausedState::rewindStep() {
+    if (!manager_.ctx.rewind) {
+        return;
+    }
+
+    rewound_ += manager_.ctx.rewind(kRewindStep);
+
+    std::ostringstream oss;
+    oss << "REWOUND " << std::fixed << std::setprecision(1) << rewound_ << " s";
+    rewindLabel_.setString(oss.str());
+    centerTextOrigin(rewindLabel_);
+}
+
+/**
+ * @brief Handles pause menu input: resume, rewind, restart, or return to menu.
  * @param event The SFML event to process.
  */
 void PausedState::handleEvent(const sf::Event& event) {
@@ -121,6 +154,11 @@ void PausedState::handleEvent(const sf::Event& event) {
         return;
     }
 
+    if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::Left) {
+        rewindStep();
+        return;
+    }
+
     if (event.type == sf::Event::Resized) {
         return;
     }
@@ -138,13 +176,18 @@ void PausedState::handleEvent(const sf::Event& event) {
     }
 
     if (hitButton(1, mx, my)) {
+        rewindStep();
+        return;
+    }
+
+    if (hitButton(2, mx, my)) {
         pop();
         pop();
         push("level");
         return;
     }
 
-    if (hitButton(2, mx, my)) {
+    if (hitButton(3, mx, my)) {
         pop();
         pop();
         push("menu");
@@ -162,6 +205,7 @@ void PausedState::draw(sf::RenderWindow& window) {
 
     window.draw(overlay_);
     window.draw(title_);
+    window.draw(rewindLabel_);
 
     const auto mousePos = sf::Mouse::getPosition(window);
     const float mx = static_cast<float>(mousePos.x);
@@ -7,19 +7,20 @@
 #include <SFML/Graphics/Text.hpp>
 
 #include <cstddef>
+#include <memory>
 #include <vector>
 
 namespace pacman::app {
 
 /**
- * @brief Pause menu state shown on top of gameplay, offering resume/restart/menu actions.
+ * @brief Pause menu state shown on top of gameplay, offering resume/rewind/restart/menu actions.
  */
 class PausedState : public State {
 public:
     using State::State;
 
     /**
-     * @brief Handles pause state input (escape and mouse clicks).
+     * @brief Handles pause state input (escape, left arrow to rewind, and mouse clicks).
      * @param event The SFML event to process.
      */
     void handleEvent(const sf::Event& event) override;
@@ -52,13 +53,21 @@ private:
      */
     bool hitButton(std::size_t index, float mx, float my) const;
 
+    /**
+     * @brief Rewinds the paused level by one step and updates the rewind label.
+     */
+    void rewindStep();
+
 private:
-    sf::Font font_;
+    std::shared_ptr<const sf::Font> font_;
     sf::Text title_;
     bool initialized_ = false;
 
     sf::RectangleShape overlay_;
 
+    sf::Text rewindLabel_;
+    double rewound_ = 0.0; ///< Seconds rewound since the pause started
+
     struct Button {
         sf::RectangleShape rect;
         sf::Text label;
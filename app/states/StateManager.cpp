@@ -2,6 +2,8 @@
 
 #include "State.h"
 
+#include "utils/TraceRecorder.h"
+
 #include <stdexcept>
 #include <utility>
 
@@ -52,31 +54,42 @@ void StateManager::clear() { pending_.push_back(Action{ActionType::Clear, {}});
 
 /**
  * @brief Applies all pending stack actions in order and clears the pending list.
+ *
+ * Each transition is traced as a span (state construction and destruction included).
  */
 void StateManager::applyPending() {
     for (const auto& action : pending_) {
         switch (action.type) {
-        case ActionType::Clear:
+        case ActionType::Clear: {
+            PACMAN_TRACE_SCOPE("state", "clear");
             stack_.clear();
             break;
+        }
 
-        case ActionType::Pop:
+        case ActionType::Pop: {
+            PACMAN_TRACE_SCOPE("state", "pop");
             if (!stack_.empty()) {
                 stack_.pop_back();
             }
             break;
+        }
 
-        case ActionType::Replace:
+        case ActionType::Replace: {
+            PACMAN_TRACE_SCOPE("state", "replace", action.id);
             if (!stack_.empty()) {
                 stack_.pop_back();
             }
             stack_.push_back(make(action.id));
             break;
+        }
 
-        case ActionType::Push:
+        case ActionType::Push: {
+            PACMAN_TRACE_SCOPE("state", "push", action.id);
             stack_.push_back(make(action.id));
             break;
         }
+        }
+        ++transitions_;
     }
 
     pending_.clear();
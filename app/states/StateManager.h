@@ -6,6 +6,7 @@
 #include <SFML/Graphics/RenderWindow.hpp>
 #include <SFML/Window/Event.hpp>
 
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <string>
@@ -92,6 +93,12 @@ public:
      */
     std::size_t size() const { return stack_.size(); }
 
+    /**
+     * @brief Returns how many stack actions have been applied so far.
+     * @return Count that changes whenever a state was pushed, replaced, popped or cleared.
+     */
+    std::uint64_t transitions() const { return transitions_; }
+
 public:
     /**
      * @brief Shared context accessible to all states.
@@ -128,6 +135,7 @@ private:
     std::vector<Action> pending_;
     std::vector<std::unique_ptr<State>> stack_;
     std::unordered_map<Id, Factory> factories_;
+    std::uint64_t transitions_{0};
 };
 
 } // namespace pacman::app
\ No newline at end of file
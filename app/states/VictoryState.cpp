@@ -2,6 +2,8 @@
 
 #include "StateManager.h"
 
+#include "../resources/ResourceCache.h"
+
 #include <SFML/Graphics/RenderWindow.hpp>
 
 #include <string>
@@ -31,16 +33,17 @@ void VictoryState::init(const sf::RenderWindow& window) {
         return;
     initialized_ = true;
 
-    if (!font_.loadFromFile("../assets/fonts/Crackman.otf")) {
+    font_ = ResourceCache::getInstance().font(assets::MainFont);
+    if (!font_) {
         throw std::runtime_error("Missing/failed to load font: assets/fonts/Crackman.otf");
     }
 
-    title_.setFont(font_);
+    title_.setFont(*font_);
     title_.setString("LEVEL CLEARED!");
     title_.setCharacterSize(64);
     title_.setFillColor(sf::Color::Green);
 
-    hint_.setFont(font_);
+    hint_.setFont(*font_);
     hint_.setString("Press any key to continue");
     hint_.setCharacterSize(32);
     hint_.setFillColor(sf::Color(200, 200, 200));
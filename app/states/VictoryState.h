@@ -5,6 +5,8 @@
 #include <SFML/Graphics/Font.hpp>
 #include <SFML/Graphics/Text.hpp>
 
+#include <memory>
+
 namespace pacman::app {
 
 /**
@@ -36,7 +38,7 @@ private:
 private:
     bool initialized_{false};
 
-    sf::Font font_;
+    std::shared_ptr<const sf::Font> font_;
     sf::Text title_;
     sf::Text hint_;
 };
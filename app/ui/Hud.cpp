@@ -1,19 +1,14 @@
 #include "Hud.h"
 
-#include "score/Score.h"
-#include "world/World.h"
-
 #include <string>
 
 namespace pacman::app {
 
 /**
  * @brief Constructs the HUD and initializes static text properties.
- * @param score Reference to the score tracker.
- * @param world Reference to the game world.
  * @param font Font used to render all HUD text.
  */
-Hud::Hud(logic::Score& score, logic::World& world, const sf::Font& font) : score_(score), world_(world) {
+Hud::Hud(const sf::Font& font) {
     const unsigned int fontSize = 22;
 
     scoreText_.setFont(font);
@@ -33,13 +28,23 @@ Hud::Hud(logic::Score& score, logic::World& world, const sf::Font& font) : score
 }
 
 /**
- * @brief Updates HUD values and renders them to the window.
+ * @brief Updates HUD values from the snapshot and renders them to the window.
  * @param window The render window to draw to.
+ * @param snapshot Latest published simulation state.
  */
-void Hud::draw(sf::RenderWindow& window) {
-    scoreText_.setString("Score: " + std::to_string(score_.value()));
-    livesText_.setString("Lives: " + std::to_string(world_.lives()));
-    levelText_.setString("Level: " + std::to_string(world_.currentLevel()));
+void Hud::draw(sf::RenderWindow& window, const logic::RenderSnapshot& snapshot) {
+    if (snapshot.score != shownScore_) {
+        shownScore_ = snapshot.score;
+        scoreText_.setString("Score: " + std::to_string(shownScore_));
+    }
+    if (snapshot.lives != shownLives_) {
+        shownLives_ = snapshot.lives;
+        livesText_.setString("Lives: " + std::to_string(shownLives_));
+    }
+    if (snapshot.currentLevel != shownLevel_) {
+        shownLevel_ = snapshot.currentLevel;
+        levelText_.setString("Level: " + std::to_string(shownLevel_));
+    }
 
     window.draw(scoreText_);
     window.draw(livesText_);
@@ -1,7 +1,6 @@
 #pragma once
 
-#include "score/Score.h"
-#include "world/World.h"
+#include "world/RenderSnapshot.h"
 
 #include <SFML/Graphics/RenderWindow.hpp>
 #include <SFML/Graphics/Text.hpp>
@@ -14,26 +13,26 @@ namespace pacman::app {
 class Hud {
 public:
     /**
-     * @brief Constructs the HUD using shared game data and a common font.
-     * @param score Reference to the global score tracker.
-     * @param world Reference to the game world.
+     * @brief Constructs the HUD using a common font.
      * @param font Font used for rendering text.
      */
-    Hud(logic::Score& score, logic::World& world, const sf::Font& font);
+    explicit Hud(const sf::Font& font);
 
     /**
-     * @brief Draws the HUD text elements.
+     * @brief Draws the HUD text elements for the given render snapshot.
      * @param window The render window to draw to.
+     * @param snapshot Latest published simulation state.
      */
-    void draw(sf::RenderWindow& window);
+    void draw(sf::RenderWindow& window, const logic::RenderSnapshot& snapshot);
 
 private:
-    logic::Score& score_;
-    logic::World& world_;
-
     sf::Text scoreText_;
     sf::Text livesText_;
     sf::Text levelText_;
+
+    int shownScore_{-1}; ///< Values currently in the texts; strings are only rebuilt when they change
+    int shownLives_{-1};
+    int shownLevel_{-1};
 };
 
-} // namespace pacman::app
\ No newline at end of file
+} // namespace pacman::app
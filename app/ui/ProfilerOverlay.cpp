@@ -0,0 +1,136 @@
+#include "ProfilerOverlay.h"
+
+#include <cstdio>
+
+namespace pacman::app {
+
+namespace {
+constexpr float kBarWidth = 2.0f;
+constexpr float kGraphHeight = 120.0f;
+constexpr float kMargin = 10.0f;
+constexpr double kBudgetNs = 1e9 / 60.0; ///< Full graph height
+constexpr unsigned int kLegendInterval = 15;
+constexpr unsigned int kLegendFontSize = 12;
+constexpr float kLegendLineHeight = 14.0f;
+
+const sf::Color kBackground(0, 0, 0, 160);
+const sf::Color kBudgetLine(255, 255, 255, 120);
+
+/**
+ * @brief Returns the color of a phase; World phases are cool, game loop phases warm.
+ * @param phase Phase index.
+ * @return Segment color.
+ */
+sf::Color phaseColor(std::size_t phase) {
+    static const sf::Color colors[logic::ProfilePhaseCount] = {
+        sf::Color(80, 80, 255),  sf::Color(0, 160, 255),  sf::Color(0, 220, 220),  sf::Color(0, 200, 120),
+        sf::Color(120, 220, 0),  sf::Color(180, 120, 255), sf::Color(255, 120, 255), sf::Color(160, 160, 160),
+        sf::Color(255, 200, 0),  sf::Color(255, 120, 0),   sf::Color(255, 60, 60)};
+    return colors[phase];
+}
+
+/**
+ * @brief Appends an axis-aligned quad to a vertex array.
+ * @param vertices Target array (Quads).
+ * @param x Left edge.
+ * @param y Top edge.
+ * @param w Width.
+ * @param h Height.
+ * @param color Fill color.
+ */
+void appendQuad(sf::VertexArray& vertices, float x, float y, float w, float h, const sf::Color& color) {
+    vertices.append(sf::Vertex({x, y}, color));
+    vertices.append(sf::Vertex({x + w, y}, color));
+    vertices.append(sf::Vertex({x + w, y + h}, color));
+    vertices.append(sf::Vertex({x, y + h}, color));
+}
+} // namespace
+
+/**
+ * @brief Constructs the overlay and initializes the legend texts.
+ * @param font Font used for the legend.
+ */
+ProfilerOverlay::ProfilerOverlay(const sf::Font& font) : bars_(sf::Quads) {
+    for (std::size_t i = 0; i < legend_.size(); ++i) {
+        legend_[i].setFont(font);
+        legend_[i].setCharacterSize(kLegendFontSize);
+        legend_[i].setFillColor(phaseColor(i));
+    }
+}
+
+/**
+ * @brief Rebuilds the legend strings ("name p95 <= N us") from the profiler's histograms.
+ */
+void ProfilerOverlay::updateLegend() {
+    const auto& profiler = logic::Profiler::getInstance();
+
+    char line[48];
+    for (std::size_t i = 0; i < legend_.size(); ++i) {
+        const auto phase = static_cast<logic::ProfilePhase>(i);
+        std::snprintf(line, sizeof(line), "%-10s p95 <= %.0f us", logic::Profiler::name(phase),
+                      profiler.percentileUs(phase, 0.95));
+        legend_[i].setString(line);
+    }
+}
+
+/**
+ * @brief Draws the graph and legend in the bottom-right corner of the window.
+ *
+ * The newest frame is drawn on the right. Segments are stacked in phase order; frames over budget run past the
+ * top of the graph. The update phase contains the World phases of the same steps, so its segment only shows the
+ * remainder (input, recording, snapshot publishing); its legend line keeps the full step time.
+ *
+ * @param window The render window to draw to.
+ */
+void ProfilerOverlay::draw(sf::RenderWindow& window) {
+    const auto& profiler = logic::Profiler::getInstance();
+    const auto size = window.getSize();
+
+    const float graphWidth = kBarWidth * static_cast<float>(logic::Profiler::HistoryFrames);
+    const float left = static_cast<float>(size.x) - graphWidth - kMargin;
+    const float bottom = static_cast<float>(size.y) - kMargin;
+    const float top = bottom - kGraphHeight;
+
+    bars_.clear();
+    appendQuad(bars_, left, top, graphWidth, kGraphHeight, kBackground);
+    appendQuad(bars_, left, top, graphWidth, 1.0f, kBudgetLine);
+
+    for (std::size_t ago = 0; ago < logic::Profiler::HistoryFrames; ++ago) {
+        const float x = left + graphWidth - kBarWidth * static_cast<float>(ago + 1);
+        float y = bottom;
+
+        std::int64_t worldNs = 0;
+        for (std::size_t i = 0; i < logic::ProfilePhaseCount; ++i) {
+            const auto phase = static_cast<logic::ProfilePhase>(i);
+            auto ns = profiler.frameNs(ago, phase);
+            if (phase < logic::ProfilePhase::Events) {
+                worldNs += ns;
+            } else if (phase == logic::ProfilePhase::Update) {
+                ns -= worldNs;
+            }
+            if (ns <= 0) {
+                continue;
+            }
+
+            const auto h = static_cast<float>(static_cast<double>(ns) / kBudgetNs * kGraphHeight);
+            y -= h;
+            appendQuad(bars_, x, y, kBarWidth, h, phaseColor(i));
+        }
+    }
+
+    window.draw(bars_);
+
+    if (framesUntilLegend_ == 0) {
+        updateLegend();
+        framesUntilLegend_ = kLegendInterval;
+    }
+    --framesUntilLegend_;
+
+    const float legendTop = top - kLegendLineHeight * static_cast<float>(legend_.size()) - 4.0f;
+    for (std::size_t i = 0; i < legend_.size(); ++i) {
+        legend_[i].setPosition(left, legendTop + kLegendLineHeight * static_cast<float>(i));
+        window.draw(legend_[i]);
+    }
+}
+
+} // namespace pacman::app
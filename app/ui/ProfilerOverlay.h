@@ -0,0 +1,46 @@
+#pragma once
+
+#include "utils/Profiler.h"
+
+#include <SFML/Graphics/RenderWindow.hpp>
+#include <SFML/Graphics/Text.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
+
+#include <array>
+
+namespace pacman::app {
+
+/**
+ * @brief Debug overlay drawing the profiler's frame history as a stacked bar graph with a legend.
+ *
+ * One bar per frame (the last Profiler::HistoryFrames), one colored segment per phase, scaled so the full height
+ * is one 60 Hz frame. The legend lists each phase with its rolling p95; it is refreshed a few times per second so
+ * the overlay itself stays cheap.
+ */
+class ProfilerOverlay {
+public:
+    /**
+     * @brief Constructs the overlay using a common font.
+     * @param font Font used for the legend.
+     */
+    explicit ProfilerOverlay(const sf::Font& font);
+
+    /**
+     * @brief Draws the graph and legend in the bottom-right corner of the window.
+     * @param window The render window to draw to.
+     */
+    void draw(sf::RenderWindow& window);
+
+private:
+    /**
+     * @brief Rebuilds the legend strings from the profiler's histograms.
+     */
+    void updateLegend();
+
+private:
+    sf::VertexArray bars_;
+    std::array<sf::Text, logic::ProfilePhaseCount> legend_;
+    unsigned int framesUntilLegend_{0};
+};
+
+} // namespace pacman::app
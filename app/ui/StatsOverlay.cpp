@@ -0,0 +1,104 @@
+#include "StatsOverlay.h"
+
+#include "observer/Event.h"
+
+#include <cstdio>
+#include <string>
+
+namespace pacman::app {
+
+namespace {
+constexpr float kMargin = 10.0f;
+constexpr float kPadding = 4.0f;
+constexpr unsigned int kUpdateInterval = 15;
+constexpr unsigned int kFontSize = 12;
+
+const sf::Color kBackground(0, 0, 0, 160);
+} // namespace
+
+/**
+ * @brief Constructs the overlay and initializes the text properties.
+ * @param font Font used for the text.
+ */
+StatsOverlay::StatsOverlay(const sf::Font& font) {
+    text_.setFont(font);
+    text_.setCharacterSize(kFontSize);
+    text_.setFillColor(sf::Color::White);
+    background_.setFillColor(kBackground);
+}
+
+/**
+ * @brief Rebuilds the text ("name value" per line) from the counters gained since the previous refresh.
+ *
+ * When the counters went backwards (new world, reset) the totals since then are used instead.
+ *
+ * @param stats Current counters.
+ */
+void StatsOverlay::updateText(const logic::SimStats& stats) {
+    if (!logic::SimStats::enabled()) {
+        text_.setString("simulation stats compiled out");
+        return;
+    }
+
+    const logic::SimStats base = stats.ticks >= previous_.ticks ? previous_ : logic::SimStats{};
+    const std::uint64_t ticks = stats.ticks - base.ticks;
+    if (ticks == 0) {
+        return;
+    }
+
+    const auto perTick = [ticks](std::uint64_t now, std::uint64_t before) {
+        return static_cast<double>(now - before) / static_cast<double>(ticks);
+    };
+
+    char line[64];
+    std::string text = "sim per tick\n";
+
+    std::snprintf(line, sizeof(line), "pair tests   %9.1f\n", perTick(stats.pairTests, base.pairTests));
+    text += line;
+    std::snprintf(line, sizeof(line), "overlaps     %9.2f\n", perTick(stats.overlapsResolved, base.overlapsResolved));
+    text += line;
+    std::snprintf(line, sizeof(line), "viability    %9.1f\n",
+                  perTick(stats.moveViabilityChecks, base.moveViabilityChecks));
+    text += line;
+    std::snprintf(line, sizeof(line), "decisions    %9.2f\n", perTick(stats.ghostDecisions, base.ghostDecisions));
+    text += line;
+    std::snprintf(line, sizeof(line), "corridor     %9.2f\n",
+                  perTick(stats.ghostDecisionsSkipped, base.ghostDecisionsSkipped));
+    text += line;
+    for (std::size_t i = 0; i < logic::EventTypeCount; ++i) {
+        std::snprintf(line, sizeof(line), "ev %-9s %9.2f\n", logic::eventTypeName(static_cast<logic::EventType>(i)),
+                      perTick(stats.events[i], base.events[i]));
+        text += line;
+    }
+    std::snprintf(line, sizeof(line), "active       %9u", stats.activeEntities);
+    text += line;
+
+    text_.setString(text);
+    previous_ = stats;
+}
+
+/**
+ * @brief Draws the counters in the bottom-left corner of the window.
+ * @param window The render window to draw to.
+ * @param stats Counters of the simulated world, from the latest render snapshot.
+ */
+void StatsOverlay::draw(sf::RenderWindow& window, const logic::SimStats& stats) {
+    if (framesUntilUpdate_ == 0) {
+        updateText(stats);
+        framesUntilUpdate_ = kUpdateInterval;
+    }
+    --framesUntilUpdate_;
+
+    const sf::FloatRect bounds = text_.getLocalBounds();
+    const float left = kMargin;
+    const float top = static_cast<float>(window.getSize().y) - kMargin - bounds.height - bounds.top - 2.0f * kPadding;
+
+    background_.setPosition(left, top);
+    background_.setSize({bounds.width + bounds.left + 2.0f * kPadding, bounds.height + bounds.top + 2.0f * kPadding});
+    text_.setPosition(left + kPadding, top + kPadding);
+
+    window.draw(background_);
+    window.draw(text_);
+}
+
+} // namespace pacman::app
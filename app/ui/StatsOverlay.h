@@ -0,0 +1,46 @@
+#pragma once
+
+#include "world/SimStats.h"
+
+#include <SFML/Graphics/RectangleShape.hpp>
+#include <SFML/Graphics/RenderWindow.hpp>
+#include <SFML/Graphics/Text.hpp>
+
+namespace pacman::app {
+
+/**
+ * @brief Debug overlay listing the simulation's work counters as averages per tick.
+ *
+ * Drawn next to the profiler overlay. The averages cover the ticks since the previous refresh, which happens a
+ * few times per second.
+ */
+class StatsOverlay {
+public:
+    /**
+     * @brief Constructs the overlay using a common font.
+     * @param font Font used for the text.
+     */
+    explicit StatsOverlay(const sf::Font& font);
+
+    /**
+     * @brief Draws the counters in the bottom-left corner of the window.
+     * @param window The render window to draw to.
+     * @param stats Counters of the simulated world, from the latest render snapshot.
+     */
+    void draw(sf::RenderWindow& window, const logic::SimStats& stats);
+
+private:
+    /**
+     * @brief Rebuilds the text from the counters gained since the previous refresh.
+     * @param stats Current counters.
+     */
+    void updateText(const logic::SimStats& stats);
+
+private:
+    sf::RectangleShape background_;
+    sf::Text text_;
+    logic::SimStats previous_{}; ///< Counters at the previous refresh
+    unsigned int framesUntilUpdate_{0};
+};
+
+} // namespace pacman::app
@@ -1,96 +1,58 @@
 #include "FruitView.h"
 
-#include "../logic/observer/Event.h"
+#include "SpriteBatch.h"
 
-#include <SFML/Graphics/RenderWindow.hpp>
-
-#include <cmath>
+#include <SFML/Graphics/RenderTarget.hpp>
 
 namespace pacman::app {
 
-sf::Texture FruitView::texture_{};
-bool FruitView::textureLoaded_{false};
-
 namespace {
-constexpr const char* kSpriteSheetPath = "../assets/sprites/sprite.png";
-
-constexpr unsigned int kSheetCols = 19;
-constexpr unsigned int kSheetRows = 19;
-
 constexpr unsigned int kFruitCol = 11;
 constexpr unsigned int kFruitRow = 11;
-
-/**
- * @brief Computes an SFML texture rectangle from a grid-based sprite sheet.
- * @param texture The sprite sheet texture.
- * @param col Zero-based column index in the sheet grid.
- * @param row Zero-based row index in the sheet grid.
- * @return The corresponding sub-rectangle in pixel coordinates.
- */
-sf::IntRect spriteRectFromGrid(const sf::Texture& texture, unsigned int col, unsigned int row) {
-    const auto size = texture.getSize();
-    const float cellW = static_cast<float>(size.x) / static_cast<float>(kSheetCols);
-    const float cellH = static_cast<float>(size.y) / static_cast<float>(kSheetRows);
-
-    const int left = static_cast<int>(std::round(static_cast<float>(col) * cellW));
-    const int top = static_cast<int>(std::round(static_cast<float>(row) * cellH));
-    const int right = static_cast<int>(std::round(static_cast<float>(col + 1u) * cellW));
-    const int bottom = static_cast<int>(std::round(static_cast<float>(row + 1u) * cellH));
-
-    return {left, top, right - left, bottom - top};
-}
 } // namespace
 
-/**
- * @brief Ensures the shared fruit sprite texture is loaded once.
- *
- * If loading fails, the view will simply not render (matching current behavior).
- */
-void FruitView::ensureTextureLoaded() {
-    if (textureLoaded_) {
-        return;
-    }
-
-    if (!texture_.loadFromFile(kSpriteSheetPath)) {
-        return;
-    }
-
-    textureLoaded_ = true;
-}
-
 /**
  * @brief Constructs a FruitView bound to a fruit model and prepares its sprite.
  * @param model Shared pointer to the fruit logic entity.
  */
 FruitView::FruitView(const std::shared_ptr<pacman::logic::Fruit>& model) : model_(model) {
-    ensureTextureLoaded();
+    auto& resources = ResourceCache::getInstance();
+    texture_ = resources.texture(assets::SpriteSheet);
+    grid_ = resources.grid(assets::SpriteSheet, assets::SheetCols, assets::SheetRows);
 
-    if (textureLoaded_) {
-        sprite_.setTexture(texture_);
-        sprite_.setTextureRect(spriteRectFromGrid(texture_, kFruitCol, kFruitRow));
+    if (texture_ && grid_) {
+        sprite_.setTexture(*texture_);
+        sprite_.setTextureRect(grid_->at(kFruitCol, kFruitRow));
     }
 }
 
 /**
  * @brief Handles logic events emitted by the fruit.
+ *
+ * Collection invalidates the cached pickups layer. Visibility follows the model's active flag, so a fruit
+ * restored from a world snapshot reappears once the registry is woken.
+ *
  * @param event Incoming logic event.
  */
 void FruitView::onEvent(const pacman::logic::Event& event) {
     if (event.type == pacman::logic::EventType::Collected) {
-        visible_ = false;
+        invalidate();
     }
 }
 
 /**
  * @brief Draws the fruit sprite centered inside its tile.
  *
- * Rendering is skipped if the fruit is not visible, inactive, missing a model/camera,
+ * Rendering is skipped if the fruit is inactive (collected), missing a model/camera,
  * or if the sprite sheet texture failed to load.
  *
- * @param window The render window to draw to.
+ * @param target Render target of the view's layer.
+ * @param batch Sprite batch receiving the sprite.
  */
-void FruitView::draw(sf::RenderWindow& window) {
-    if (!visible_ || !model_ || !model_->active || !camera_ || !textureLoaded_) {
+void FruitView::draw(sf::RenderTarget& target, SpriteBatch& batch) {
+    (void)target;
+
+    if (!model_ || !model_->active || !camera_ || !grid_) {
         return;
     }
 
@@ -109,7 +71,7 @@ void FruitView::draw(sf::RenderWindow& window) {
     sprite_.setPosition(posX, posY);
     sprite_.setScale(scale, scale);
 
-    window.draw(sprite_);
+    batch.add(sprite_);
 }
 
 } // namespace pacman::app
\ No newline at end of file
@@ -2,10 +2,11 @@
 
 #include "View.h"
 
+#include "../resources/ResourceCache.h"
+
 #include "../logic/entities/Fruit.h"
 
 #include <SFML/Graphics/Sprite.hpp>
-#include <SFML/Graphics/Texture.hpp>
 
 #include <memory>
 
@@ -24,28 +25,35 @@ public:
 
     /**
      * @brief Draws the fruit using world-to-pixel mapping and sprite scaling.
-     * @param window The render window to draw to.
+     * @param target Render target of the view's layer.
+     * @param batch Sprite batch receiving the sprite.
      */
-    void draw(sf::RenderWindow& window) override;
+    void draw(sf::RenderTarget& target, SpriteBatch& batch) override;
 
     /**
-     * @brief Responds to logic events (e.g., fruit collected).
+     * @brief Responds to logic events (redraws the pickups layer when the fruit is collected).
      * @param event Incoming logic event.
      */
     void onEvent(const pacman::logic::Event& event) override;
 
+    /**
+     * @brief Returns whether the fruit was collected (the registry then parks this view).
+     * @return True if there is nothing to draw.
+     */
+    bool finished() const noexcept override { return !model_ || !model_->active; }
+
+    /**
+     * @brief Returns the pickups layer, which is cached between collections.
+     * @return RenderLayer::Pickups.
+     */
+    RenderLayer layer() const noexcept override { return RenderLayer::Pickups; }
+
 private:
     std::shared_ptr<pacman::logic::Fruit> model_;
     sf::Sprite sprite_;
-    bool visible_{true};
-
-    static sf::Texture texture_;
-    static bool textureLoaded_;
 
-    /**
-     * @brief Loads the shared sprite sheet texture on first use.
-     */
-    static void ensureTextureLoaded();
+    std::shared_ptr<const sf::Texture> texture_; ///< Shared sprite sheet (nullptr if it failed to load)
+    const SpriteGrid* grid_{nullptr};            ///< Precomputed cell rectangles of the sprite sheet
 };
 
 } // namespace pacman::app
\ No newline at end of file
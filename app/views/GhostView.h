@@ -2,13 +2,14 @@
 
 #include "View.h"
 
+#include "../animation/AnimationLibrary.h"
+#include "../resources/ResourceCache.h"
+
 #include "../logic/entities/Direction.h"
 #include "../logic/entities/Ghost.h"
 #include "../logic/observer/Event.h"
-#include "../logic/utils/Stopwatch.h"
 
 #include <SFML/Graphics/Sprite.hpp>
-#include <SFML/Graphics/Texture.hpp>
 
 #include <memory>
 
@@ -27,9 +28,10 @@ public:
 
     /**
      * @brief Draws the ghost sprite using world-to-pixel mapping and animation frame selection.
-     * @param window The render window to draw to.
+     * @param target Render target of the view's layer.
+     * @param batch Sprite batch receiving the sprite.
      */
-    void draw(sf::RenderWindow& window) override;
+    void draw(sf::RenderTarget& target, SpriteBatch& batch) override;
 
     /**
      * @brief Reacts to logic events (direction changes and fear mode toggles).
@@ -39,12 +41,12 @@ public:
 
 private:
     /**
-     * @brief Loads the shared sprite sheet texture on first use.
+     * @brief Picks the animation clip for the current direction and fear mode.
      */
-    static void ensureTextureLoaded();
+    void selectClip();
 
     /**
-     * @brief Updates the sprite frame selection based on direction, fear mode, and elapsed time.
+     * @brief Updates the sprite frame selection from the current clip and the shared animation clock.
      */
     void updateSpriteFrame();
 
@@ -54,9 +56,10 @@ private:
 
     pacman::logic::Direction direction_{pacman::logic::Direction::None};
     bool fearMode_{false};
+    AnimationLibrary::ClipId clip_{0};
 
-    static sf::Texture texture_;
-    static bool textureLoaded_;
+    std::shared_ptr<const sf::Texture> texture_;  ///< Shared sprite sheet (nullptr if it failed to load)
+    const AnimationLibrary* animations_{nullptr}; ///< Precomputed animation frames
 };
 
 } // namespace pacman::app
\ No newline at end of file
@@ -2,14 +2,16 @@
 
 #include "View.h"
 
+#include "../animation/AnimationLibrary.h"
+#include "../resources/ResourceCache.h"
+
 #include "../logic/entities/Direction.h"
 #include "../logic/entities/PacMan.h"
 #include "../logic/observer/Event.h"
-#include "../logic/utils/Stopwatch.h"
 
 #include <SFML/Graphics/Sprite.hpp>
-#include <SFML/Graphics/Texture.hpp>
 
+#include <cstdint>
 #include <memory>
 
 namespace pacman::app {
@@ -27,9 +29,10 @@ public:
 
     /**
      * @brief Draws Pac-Man using world-to-pixel mapping and time-based animation.
-     * @param window The render window to draw to.
+     * @param target Render target of the view's layer.
+     * @param batch Sprite batch receiving the sprite.
      */
-    void draw(sf::RenderWindow& window) override;
+    void draw(sf::RenderTarget& target, SpriteBatch& batch) override;
 
     /**
      * @brief Reacts to logic events (direction/state changes).
@@ -37,14 +40,15 @@ public:
      */
     void onEvent(const pacman::logic::Event& event) override;
 
-private:
     /**
-     * @brief Loads the shared sprite sheet texture on first use.
+     * @brief Sets the sprite opacity (e.g. for the translucent best-run Pac-Man).
+     * @param alpha Alpha value from 0 (invisible) to 255 (opaque).
      */
-    static void ensureTextureLoaded();
+    void setOpacity(std::uint8_t alpha);
 
+private:
     /**
-     * @brief Updates the sprite frame selection based on direction and elapsed time.
+     * @brief Updates the sprite frame selection from the current clip and the shared animation clock.
      */
     void updateSpriteFrame();
 
@@ -52,9 +56,10 @@ private:
     std::shared_ptr<pacman::logic::PacMan> model_;
     sf::Sprite sprite_;
     logic::Direction direction_{logic::Direction::None};
+    AnimationLibrary::ClipId clip_{AnimationLibrary::pacManClip(logic::Direction::None)};
 
-    static sf::Texture texture_;
-    static bool textureLoaded_;
+    std::shared_ptr<const sf::Texture> texture_;  ///< Shared sprite sheet (nullptr if it failed to load)
+    const AnimationLibrary* animations_{nullptr}; ///< Precomputed animation frames
 };
 
 } // namespace pacman::app
\ No newline at end of file
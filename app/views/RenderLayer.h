@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace pacman::app {
+
+/**
+ * @brief Render layers in back-to-front order.
+ *
+ * The ViewRegistry draws layers in this order, so z-order no longer depends on the order views were created in.
+ */
+enum class RenderLayer : std::uint8_t {
+    Static,  ///< Level geometry that only changes on level load (walls)
+    Pickups, ///< Coins and fruits; change only when one is collected or the world is restored
+    Actors,  ///< Pac-Man and ghosts; redrawn every frame
+    Overlay  ///< Drawn last, above all actors; redrawn every frame
+};
+
+inline constexpr std::size_t RenderLayerCount = 4;
+
+/**
+ * @brief Returns whether a layer is composited from a cached render target.
+ * @param layer Render layer.
+ * @return True for layers that change rarely.
+ */
+constexpr bool isCachedLayer(RenderLayer layer) noexcept {
+    return layer == RenderLayer::Static || layer == RenderLayer::Pickups;
+}
+
+} // namespace pacman::app
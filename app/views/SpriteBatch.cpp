@@ -0,0 +1,72 @@
+#include "SpriteBatch.h"
+
+#include <SFML/Graphics/RenderStates.hpp>
+
+namespace pacman::app {
+
+/**
+ * @brief Queues a sprite as a quad using its texture, texture rect, transform and colour.
+ *
+ * The quad matches what sf::Sprite itself would render.
+ *
+ * @param sprite Sprite to queue (ignored if it has no texture).
+ */
+void SpriteBatch::add(const sf::Sprite& sprite) {
+    const sf::Texture* texture = sprite.getTexture();
+    if (!texture) {
+        return;
+    }
+
+    Batch* batch = nullptr;
+    for (auto& b : batches_) {
+        if (b.texture == texture) {
+            batch = &b;
+            break;
+        }
+    }
+    if (!batch) {
+        batches_.push_back(Batch{texture, sf::VertexArray(sf::Quads)});
+        batch = &batches_.back();
+    }
+
+    const sf::IntRect rect = sprite.getTextureRect();
+    const sf::Transform& transform = sprite.getTransform();
+    const sf::Color color = sprite.getColor();
+
+    const float width = static_cast<float>(rect.width < 0 ? -rect.width : rect.width);
+    const float height = static_cast<float>(rect.height < 0 ? -rect.height : rect.height);
+
+    const float left = static_cast<float>(rect.left);
+    const float right = left + static_cast<float>(rect.width);
+    const float top = static_cast<float>(rect.top);
+    const float bottom = top + static_cast<float>(rect.height);
+
+    auto& v = batch->vertices;
+    v.append(sf::Vertex(transform.transformPoint(0.0f, 0.0f), color, {left, top}));
+    v.append(sf::Vertex(transform.transformPoint(width, 0.0f), color, {right, top}));
+    v.append(sf::Vertex(transform.transformPoint(width, height), color, {right, bottom}));
+    v.append(sf::Vertex(transform.transformPoint(0.0f, height), color, {left, bottom}));
+}
+
+/**
+ * @brief Draws all queued quads (one draw call per texture) and empties the batch.
+ * @param target Render target to draw to.
+ */
+void SpriteBatch::flush(sf::RenderTarget& target) {
+    lastDrawCalls_ = 0;
+
+    for (auto& batch : batches_) {
+        if (batch.vertices.getVertexCount() == 0) {
+            continue;
+        }
+
+        sf::RenderStates states;
+        states.texture = batch.texture;
+        target.draw(batch.vertices, states);
+        ++lastDrawCalls_;
+
+        batch.vertices.clear();
+    }
+}
+
+} // namespace pacman::app
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace pacman::app {
+
+/**
+ * @brief Collects textured quads and submits them with one draw call per texture.
+ *
+ * Views add their sprites during the gather pass instead of drawing them; flush() then draws one vertex array
+ * per texture, in the order the textures were first used. Vertex storage is reused between frames, so a
+ * steady frame does not allocate.
+ */
+class SpriteBatch {
+public:
+    /**
+     * @brief Queues a sprite as a quad using its texture, texture rect, transform and colour.
+     * @param sprite Sprite to queue (ignored if it has no texture).
+     */
+    void add(const sf::Sprite& sprite);
+
+    /**
+     * @brief Draws all queued quads (one draw call per texture) and empties the batch.
+     * @param target Render target to draw to.
+     */
+    void flush(sf::RenderTarget& target);
+
+    /**
+     * @brief Returns the number of draw calls the last flush() issued.
+     * @return Draw call count.
+     */
+    std::size_t lastDrawCalls() const noexcept { return lastDrawCalls_; }
+
+private:
+    /**
+     * @brief Quads queued for one texture.
+     */
+    struct Batch {
+        const sf::Texture* texture{nullptr};
+        sf::VertexArray vertices{sf::Quads};
+    };
+
+    std::vector<Batch> batches_; ///< Kept across frames so vertex capacity is reused
+    std::size_t lastDrawCalls_{0};
+};
+
+} // namespace pacman::app
@@ -1,5 +1,10 @@
 #include "View.h"
 
+#include "ViewRegistry.h"
+
+#include <algorithm>
+#include <cmath>
+
 namespace pacman::app {
 
 /**
@@ -8,10 +13,43 @@ namespace pacman::app {
  */
 void View::onEvent(const pacman::logic::Event& event) { (void)event; }
 
+/**
+ * @brief Marks the owning registry's layer for this view as dirty.
+ */
+void View::invalidate() noexcept {
+    if (registry_) {
+        registry_->markDirty(layer());
+    }
+}
+
 /**
  * @brief Assigns the shared camera to all views.
  * @param camera Pointer to the active camera.
  */
 void View::setCamera(pacman::logic::Camera* camera) noexcept { camera_ = camera; }
 
+/**
+ * @brief Sets the interpolation factor used by all moving views.
+ * @param alpha Interpolation factor, clamped to [0, 1].
+ */
+void View::setInterpolationAlpha(float alpha) noexcept { alpha_ = std::clamp(alpha, 0.0f, 1.0f); }
+
+/**
+ * @brief Blends two bounds with the shared alpha, snapping on jumps larger than the entity.
+ * @param previous Bounds at the start of the last step.
+ * @param current Bounds after the last step.
+ * @return Bounds to draw.
+ */
+pacman::logic::Rect View::interpolate(const pacman::logic::Rect& previous,
+                                      const pacman::logic::Rect& current) noexcept {
+    const float dx = current.x - previous.x;
+    const float dy = current.y - previous.y;
+
+    if (alpha_ >= 1.0f || std::abs(dx) > current.w || std::abs(dy) > current.h) {
+        return current;
+    }
+
+    return {previous.x + dx * alpha_, previous.y + dy * alpha_, current.w, current.h};
+}
+
 } // namespace pacman::app
\ No newline at end of file
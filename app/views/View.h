@@ -1,12 +1,19 @@
 #pragma once
 
+#include "RenderLayer.h"
+
 #include "camera/Camera.h"
 #include "observer/Observer.h"
 
-#include <SFML/Graphics/RenderWindow.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+
+#include <cstddef>
 
 namespace pacman::app {
 
+class SpriteBatch;
+class ViewRegistry;
+
 /**
  * @brief Abstract base class for all renderable views.
  *
@@ -21,10 +28,11 @@ public:
     ~View() override = default;
 
     /**
-     * @brief Draws the view to the given render window.
-     * @param window The render window to draw to.
+     * @brief Draws the view, queueing sprites into the batch instead of drawing them one by one.
+     * @param target Render target of the view's layer (for content that is not batched).
+     * @param batch Sprite batch flushed after all views of the layer were gathered.
      */
-    virtual void draw(sf::RenderWindow& window) = 0;
+    virtual void draw(sf::RenderTarget& target, SpriteBatch& batch) = 0;
 
     /**
      * @brief Receives events from observed models.
@@ -35,17 +43,70 @@ public:
      */
     void onEvent(const pacman::logic::Event& event) override;
 
+    /**
+     * @brief Returns whether the view has nothing to draw until the world state is restored or reloaded.
+     *
+     * The ViewRegistry parks finished views and skips them until they are woken. Default: never finished.
+     *
+     * @return True if the view can be parked.
+     */
+    virtual bool finished() const noexcept { return false; }
+
+    /**
+     * @brief Returns the layer the view is drawn in. Must not change while the view is registered.
+     * @return Render layer (default: Actors).
+     */
+    virtual RenderLayer layer() const noexcept { return RenderLayer::Actors; }
+
     /**
      * @brief Sets the shared camera used by all views.
      * @param camera Pointer to the active camera (not owned).
      */
     static void setCamera(pacman::logic::Camera* camera) noexcept;
 
+    /**
+     * @brief Sets how far rendering is between the previous and the current simulation step.
+     * @param alpha Interpolation factor, clamped to [0, 1] (1 draws the latest state).
+     */
+    static void setInterpolationAlpha(float alpha) noexcept;
+
 protected:
+    /**
+     * @brief Tells the owning registry that this view's cached layer must be redrawn.
+     *
+     * Views in cached layers call this when their appearance changes; it is a no-op for other layers.
+     */
+    void invalidate() noexcept;
+
+    /**
+     * @brief Blends the bounds of a moving entity between two simulation steps using the shared alpha.
+     *
+     * Jumps larger than the entity itself (tunnel wrap, respawn) are not blended, so the entity never sweeps
+     * across the maze.
+     *
+     * @param previous Bounds at the start of the last step.
+     * @param current Bounds after the last step.
+     * @return Bounds to draw.
+     */
+    static pacman::logic::Rect interpolate(const pacman::logic::Rect& previous,
+                                           const pacman::logic::Rect& current) noexcept;
+
     /**
      * @brief Shared camera used for rendering.
      */
     inline static pacman::logic::Camera* camera_ = nullptr;
+
+    /**
+     * @brief Shared interpolation factor between the previous and the current simulation step.
+     */
+    inline static float alpha_ = 1.0f;
+
+private:
+    friend class ViewRegistry;
+
+    ViewRegistry* registry_{nullptr}; ///< Owning registry, set while registered
+    std::size_t registrySlot_{0};     ///< Position in the owning layer, maintained by the registry
+    std::size_t registryOrder_{0};    ///< Registration sequence number (original draw order)
 };
 
 } // namespace pacman::app
\ No newline at end of file
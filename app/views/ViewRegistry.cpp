@@ -1,36 +1,271 @@
 #include "ViewRegistry.h"
 
+#include <algorithm>
+#include <utility>
+
 namespace pacman::app {
 
 /**
- * @brief Registers a non-null view into the registry.
+ * @brief Detaches all views before they are destroyed.
+ */
+ViewRegistry::~ViewRegistry() { clear(); }
+
+/**
+ * @brief Registers a non-null view as live in the layer it reports.
  * @param view The view to store.
  */
 void ViewRegistry::add(Ptr view) {
-    if (view) {
-        views_.push_back(std::move(view));
+    if (!view) {
+        return;
+    }
+
+    Layer& layer = layers_[index(view->layer())];
+
+    view->registry_ = this;
+    view->registrySlot_ = layer.views.size();
+    view->registryOrder_ = nextOrder_++;
+    layer.views.push_back(std::move(view));
+    swapSlots(layer, layer.views.size() - 1, layer.liveCount);
+    ++layer.liveCount;
+    layer.dirty = true;
+}
+
+/**
+ * @brief Draws all layers back to front, serving cached layers from their render textures.
+ *
+ * If a cached layer cannot be baked (no render texture support), it is drawn directly every frame instead.
+ *
+ * @param target The render target to draw to.
+ */
+void ViewRegistry::drawAll(sf::RenderTarget& target) {
+    const sf::Vector2u size = target.getSize();
+
+    for (std::size_t i = 0; i < RenderLayerCount; ++i) {
+        Layer& layer = layers_[i];
+
+        if (!isCachedLayer(static_cast<RenderLayer>(i))) {
+            drawViews(layer, target);
+            continue;
+        }
+
+        if (layer.dirty || layer.bakedSize != size) {
+            layer.baked = bake(layer, size);
+        }
+
+        if (layer.baked) {
+            target.draw(layer.sprite);
+        } else {
+            drawViews(layer, target);
+        }
+    }
+}
+
+/**
+ * @brief Marks a cached layer for redrawing.
+ * @param layer Render layer.
+ */
+void ViewRegistry::markDirty(RenderLayer layer) noexcept { layers_[index(layer)].dirty = true; }
+
+/**
+ * @brief Gathers the live views of a layer into the batch and flushes it with one draw per texture.
+ *
+ * Live views are compacted towards the front while drawing; finished ones are moved behind them into the
+ * parked range. Both passes touch only the live range, and the scratch list keeps its capacity between frames.
+ *
+ * @param layer Layer to draw.
+ * @param target Render target (window or the layer's cache).
+ */
+void ViewRegistry::drawViews(Layer& layer, sf::RenderTarget& target) {
+    std::size_t live = 0;
+    for (std::size_t i = 0; i < layer.liveCount; ++i) {
+        if (layer.views[i]->finished()) {
+            finished_.push_back(std::move(layer.views[i]));
+            continue;
+        }
+
+        layer.views[i]->draw(target, batch_);
+        if (live != i) {
+            layer.views[live] = std::move(layer.views[i]);
+            layer.views[live]->registrySlot_ = live;
+        }
+        ++live;
+    }
+
+    for (std::size_t i = 0; i < finished_.size(); ++i) {
+        layer.views[live + i] = std::move(finished_[i]);
+        layer.views[live + i]->registrySlot_ = live + i;
+    }
+    finished_.clear();
+    layer.liveCount = live;
+
+    batch_.flush(target);
+}
+
+/**
+ * @brief Re-renders a cached layer into its render texture, recreating the texture if the size changed.
+ * @param layer Layer to bake.
+ * @param size Size of the final render target.
+ * @return True if the layer can be drawn from its cache.
+ */
+bool ViewRegistry::bake(Layer& layer, sf::Vector2u size) {
+    layer.dirty = false;
+
+    if (layer.bakedSize != size || !layer.baked) {
+        layer.bakedSize = size;
+        if (size.x == 0 || size.y == 0 || !layer.texture.create(size.x, size.y)) {
+            return false;
+        }
+    }
+
+    layer.texture.clear(sf::Color::Transparent);
+    drawViews(layer, layer.texture);
+    layer.texture.display();
+
+    layer.sprite.setTexture(layer.texture.getTexture(), true);
+    return true;
+}
+
+/**
+ * @brief Stops drawing a view until it is woken again.
+ * @param view A view owned by this registry.
+ */
+void ViewRegistry::park(View& view) {
+    if (!owns(view)) {
+        return;
+    }
+
+    Layer& layer = layers_[index(view.layer())];
+    if (view.registrySlot_ >= layer.liveCount) {
+        return;
+    }
+
+    --layer.liveCount;
+    swapSlots(layer, view.registrySlot_, layer.liveCount);
+    layer.dirty = true;
+}
+
+/**
+ * @brief Resumes drawing a parked view.
+ * @param view A view owned by this registry.
+ */
+void ViewRegistry::wake(View& view) {
+    if (!owns(view)) {
+        return;
+    }
+
+    Layer& layer = layers_[index(view.layer())];
+    if (view.registrySlot_ < layer.liveCount) {
+        return;
+    }
+
+    swapSlots(layer, view.registrySlot_, layer.liveCount);
+    ++layer.liveCount;
+    layer.dirty = true;
+}
+
+/**
+ * @brief Resumes drawing all parked views in their original registration order and marks every layer dirty.
+ *
+ * Runs in O(n log n) per layer with parked views, which is fine for the rare world restores that call it.
+ */
+void ViewRegistry::wakeAll() noexcept {
+    for (Layer& layer : layers_) {
+        layer.dirty = true;
+        if (layer.liveCount == layer.views.size()) {
+            continue;
+        }
+
+        std::sort(layer.views.begin(), layer.views.end(),
+                  [](const Ptr& a, const Ptr& b) { return a->registryOrder_ < b->registryOrder_; });
+        for (std::size_t i = 0; i < layer.views.size(); ++i) {
+            layer.views[i]->registrySlot_ = i;
+        }
+        layer.liveCount = layer.views.size();
     }
 }
 
 /**
- * @brief Draws all registered views.
- * @param window The render window to draw to.
+ * @brief Destroys a view that is permanently done.
+ *
+ * The view is first parked (so the live range stays contiguous), then swapped with the last element and popped.
+ *
+ * @param view A view owned by this registry (invalid after the call).
  */
-void ViewRegistry::drawAll(sf::RenderWindow& window) {
-    for (auto& view : views_) {
-        view->draw(window);
+void ViewRegistry::remove(View& view) {
+    if (!owns(view)) {
+        return;
     }
+
+    park(view);
+
+    Layer& layer = layers_[index(view.layer())];
+    swapSlots(layer, view.registrySlot_, layer.views.size() - 1);
+    layer.views.back()->registry_ = nullptr;
+    layer.views.pop_back();
+}
+
+/**
+ * @brief Returns the number of registered views across all layers.
+ * @return Total view count.
+ */
+std::size_t ViewRegistry::size() const noexcept {
+    std::size_t total = 0;
+    for (const Layer& layer : layers_) {
+        total += layer.views.size();
+    }
+    return total;
 }
 
 /**
  * @brief Clears all views from the registry.
  */
-void ViewRegistry::clear() { views_.clear(); }
+void ViewRegistry::clear() {
+    for (Layer& layer : layers_) {
+        for (auto& view : layer.views) {
+            view->registry_ = nullptr;
+        }
+        layer.views.clear();
+        layer.liveCount = 0;
+        layer.dirty = true;
+    }
+    nextOrder_ = 0;
+}
 
 /**
- * @brief Returns the internal container of views.
+ * @brief Returns the view container of a layer.
+ * @param layer Render layer.
  * @return Reference to the view vector.
  */
-std::vector<ViewRegistry::Ptr>& ViewRegistry::raw() { return views_; }
+std::vector<ViewRegistry::Ptr>& ViewRegistry::raw(RenderLayer layer) { return layers_[index(layer)].views; }
+
+/**
+ * @brief Swaps two slots of a layer and updates the slot indices stored in the views.
+ * @param layer Layer owning both slots.
+ * @param a First slot.
+ * @param b Second slot.
+ */
+void ViewRegistry::swapSlots(Layer& layer, std::size_t a, std::size_t b) noexcept {
+    if (a == b) {
+        return;
+    }
+
+    std::swap(layer.views[a], layer.views[b]);
+    layer.views[a]->registrySlot_ = a;
+    layer.views[b]->registrySlot_ = b;
+}
+
+/**
+ * @brief Checks that a view is owned by this registry.
+ * @param view View to look up.
+ * @return True if the view's slot refers back to it.
+ */
+bool ViewRegistry::owns(const View& view) const noexcept {
+    if (view.registry_ != this) {
+        return false;
+    }
+
+    const Layer& layer = layers_[index(view.layer())];
+    return view.registrySlot_ < layer.views.size() && layer.views[view.registrySlot_].get() == &view;
+}
 
-} // namespace pacman::app
\ No newline at end of file
+} // namespace pacman::app
@@ -1,9 +1,15 @@
 #pragma once
 
+#include "RenderLayer.h"
+#include "SpriteBatch.h"
 #include "View.h"
 
-#include <SFML/Graphics/RenderWindow.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/Sprite.hpp>
 
+#include <array>
+#include <cstddef>
 #include <memory>
 #include <vector>
 
@@ -13,7 +19,17 @@ namespace pacman::app {
  * @brief Owns and manages all active views for rendering.
  *
  * The registry batches drawing calls and centralizes ownership
- * of all view instances created during gameplay.
+ * of all view instances created during gameplay. Views are grouped by RenderLayer and layers are drawn back to
+ * front; within a layer, views are gathered into the shared sprite batch and flushed once.
+ *
+ * The static and pickups layers are composited from cached render targets. They are redrawn only when marked
+ * dirty (a view was added, parked, woken or invalidated) or the target size changes, so a normal frame costs one
+ * sprite per cached layer plus the actor and overlay layers.
+ *
+ * Each layer's vector is split into a live front and a parked tail. Drawing a layer only visits live views and
+ * parks every view that reports finished() (e.g. an eaten coin) in the same pass, keeping the draw order of the
+ * remaining live views. Explicit park(), wake() and remove() swap a view across the boundary or with the last
+ * element and are O(1); wakeAll() restores registration order.
  */
 class ViewRegistry {
 public:
@@ -22,17 +38,77 @@ public:
      */
     using Ptr = std::unique_ptr<View>;
 
+    ViewRegistry() = default;
+    ~ViewRegistry();
+
+    ViewRegistry(const ViewRegistry&) = delete;
+    ViewRegistry& operator=(const ViewRegistry&) = delete;
+
     /**
-     * @brief Registers a new view in the registry.
+     * @brief Registers a new view as live in the layer it reports.
      * @param view The view to add (ignored if null).
      */
     void add(Ptr view);
 
     /**
-     * @brief Draws all registered views to the given render window.
-     * @param window The render window to draw to.
+     * @brief Draws all layers back to front.
+     *
+     * Cached layers are re-rendered into their render target first if they are dirty.
+     *
+     * @param target The render target to draw to.
+     */
+    void drawAll(sf::RenderTarget& target);
+
+    /**
+     * @brief Returns the batch used by drawAll() (e.g. to inspect draw call counts).
+     * @return Reference to the sprite batch.
+     */
+    const SpriteBatch& batch() const noexcept { return batch_; }
+
+    /**
+     * @brief Marks a layer for redrawing (no-op for layers that are redrawn every frame anyway).
+     * @param layer Render layer.
+     */
+    void markDirty(RenderLayer layer) noexcept;
+
+    /**
+     * @brief Stops drawing a view until it is woken again.
+     * @param view A view owned by this registry.
+     */
+    void park(View& view);
+
+    /**
+     * @brief Resumes drawing a parked view.
+     * @param view A view owned by this registry.
+     */
+    void wake(View& view);
+
+    /**
+     * @brief Resumes drawing all parked views and marks every layer dirty.
+     *
+     * Call this after the world state was restored (rewind, replay seek), since that can bring finished
+     * entities back. Views that are still finished are parked again the next time their layer is drawn.
+     */
+    void wakeAll() noexcept;
+
+    /**
+     * @brief Destroys a view that is permanently done.
+     * @param view A view owned by this registry (invalid after the call).
+     */
+    void remove(View& view);
+
+    /**
+     * @brief Returns the number of live views in a layer.
+     * @param layer Render layer.
+     * @return Live view count.
+     */
+    std::size_t liveCount(RenderLayer layer) const noexcept { return layers_[index(layer)].liveCount; }
+
+    /**
+     * @brief Returns the number of registered views, live and parked, across all layers.
+     * @return Total view count.
      */
-    void drawAll(sf::RenderWindow& window);
+    std::size_t size() const noexcept;
 
     /**
      * @brief Removes all registered views.
@@ -40,13 +116,69 @@ public:
     void clear();
 
     /**
-     * @brief Provides direct access to the internal view container.
-     * @return Reference to the vector of view pointers.
+     * @brief Provides direct access to the view container of a layer.
+     * @param layer Render layer.
+     * @return Reference to the vector of view pointers (live views first, then parked ones).
+     */
+    std::vector<Ptr>& raw(RenderLayer layer);
+
+private:
+    /**
+     * @brief Views of one render layer plus its cache.
+     */
+    struct Layer {
+        std::vector<Ptr> views;
+        std::size_t liveCount{0}; ///< views[0, liveCount) are drawn, the rest are parked
+
+        bool dirty{true};          ///< Cached layers only: render target is out of date
+        bool baked{false};         ///< Cached layers only: render target holds the layer
+        sf::Vector2u bakedSize{};  ///< Target size the cache was rendered for
+        sf::RenderTexture texture; ///< Cached layers only
+        sf::Sprite sprite;         ///< Draws the cached texture
+    };
+
+    /**
+     * @brief Converts a layer to its array index.
+     * @param layer Render layer.
+     * @return Index into layers_.
+     */
+    static constexpr std::size_t index(RenderLayer layer) noexcept { return static_cast<std::size_t>(layer); }
+
+    /**
+     * @brief Gathers the live views of a layer into the batch and flushes it to the target.
+     * @param layer Layer to draw.
+     * @param target Render target (window or the layer's cache).
+     */
+    void drawViews(Layer& layer, sf::RenderTarget& target);
+
+    /**
+     * @brief Re-renders a cached layer into its render texture.
+     * @param layer Layer to bake.
+     * @param size Size of the final render target.
+     * @return True if the layer can be drawn from its cache.
+     */
+    bool bake(Layer& layer, sf::Vector2u size);
+
+    /**
+     * @brief Swaps two slots of a layer and updates the slot indices stored in the views.
+     * @param layer Layer owning both slots.
+     * @param a First slot.
+     * @param b Second slot.
+     */
+    static void swapSlots(Layer& layer, std::size_t a, std::size_t b) noexcept;
+
+    /**
+     * @brief Checks that a view is owned by this registry.
+     * @param view View to look up.
+     * @return True if the view's slot refers back to it.
      */
-    std::vector<Ptr>& raw();
+    bool owns(const View& view) const noexcept;
 
 private:
-    std::vector<Ptr> views_;
+    std::array<Layer, RenderLayerCount> layers_;
+    std::size_t nextOrder_{0};  ///< Registration counter
+    std::vector<Ptr> finished_; ///< Scratch list for views parked while drawing
+    SpriteBatch batch_;
 };
 
-} // namespace pacman::app
\ No newline at end of file
+} // namespace pacman::app
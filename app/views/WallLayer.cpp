@@ -0,0 +1,73 @@
+#include "WallLayer.h"
+
+#include <SFML/Graphics/RenderTarget.hpp>
+
+namespace pacman::app {
+
+namespace {
+const sf::Color kWallColor(0, 0, 255);
+} // namespace
+
+/**
+ * @brief Adds a wall to the layer and marks it for rebuilding.
+ * @param wall Wall model (its bounds and visibility are read when the layer is rebuilt).
+ */
+void WallLayer::addWall(const std::shared_ptr<pacman::logic::Wall>& wall) {
+    if (!wall) {
+        return;
+    }
+
+    walls_.push_back(wall);
+    dirty_ = true;
+    invalidate();
+}
+
+/**
+ * @brief Draws all wall quads with one draw call, rebuilding them first if walls or the viewport changed.
+ * @param target Render target of the static layer.
+ * @param batch Unused; the walls are already a single draw call.
+ */
+void WallLayer::draw(sf::RenderTarget& target, SpriteBatch& batch) {
+    (void)batch;
+
+    if (!camera_) {
+        return;
+    }
+
+    if (dirty_ || camera_->width() != viewportWidth_ || camera_->height() != viewportHeight_) {
+        rebuild();
+    }
+
+    target.draw(vertices_);
+}
+
+/**
+ * @brief Rebuilds the wall quads in pixel space.
+ *
+ * Only active, visible walls are included (the ghost gate is invisible).
+ */
+void WallLayer::rebuild() {
+    dirty_ = false;
+    viewportWidth_ = camera_->width();
+    viewportHeight_ = camera_->height();
+
+    vertices_.clear();
+    for (const auto& wall : walls_) {
+        if (!wall->active || !wall->visible) {
+            continue;
+        }
+
+        const auto r = camera_->worldToPixel(wall->bounds());
+        const float left = static_cast<float>(r.x);
+        const float top = static_cast<float>(r.y);
+        const float right = static_cast<float>(r.x + r.w);
+        const float bottom = static_cast<float>(r.y + r.h);
+
+        vertices_.append(sf::Vertex({left, top}, kWallColor));
+        vertices_.append(sf::Vertex({right, top}, kWallColor));
+        vertices_.append(sf::Vertex({right, bottom}, kWallColor));
+        vertices_.append(sf::Vertex({left, bottom}, kWallColor));
+    }
+}
+
+} // namespace pacman::app
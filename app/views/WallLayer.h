@@ -0,0 +1,57 @@
+#pragma once
+
+#include "View.h"
+
+#include "../logic/entities/Wall.h"
+
+#include <SFML/Graphics/VertexArray.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace pacman::app {
+
+/**
+ * @brief View that renders all walls of a level as one vertex array in the static layer.
+ *
+ * The quads are rebuilt only when walls are added (a level was loaded) or the camera viewport changes. The
+ * ViewRegistry caches the static layer in a render target, so the walls are only drawn again in those cases.
+ */
+class WallLayer : public View {
+public:
+    /**
+     * @brief Adds a wall to the layer and marks it for rebuilding.
+     * @param wall Wall model (its bounds and visibility are read when the layer is rebuilt).
+     */
+    void addWall(const std::shared_ptr<pacman::logic::Wall>& wall);
+
+    /**
+     * @brief Draws all wall quads with one draw call, rebuilding them first if needed.
+     * @param target Render target of the static layer.
+     * @param batch Unused; the walls are already a single draw call.
+     */
+    void draw(sf::RenderTarget& target, SpriteBatch& batch) override;
+
+    /**
+     * @brief Returns the static layer.
+     * @return RenderLayer::Static.
+     */
+    RenderLayer layer() const noexcept override { return RenderLayer::Static; }
+
+private:
+    /**
+     * @brief Rebuilds the wall quads in pixel space.
+     */
+    void rebuild();
+
+private:
+    std::vector<std::shared_ptr<pacman::logic::Wall>> walls_;
+
+    sf::VertexArray vertices_{sf::Quads};
+
+    bool dirty_{true};
+    int viewportWidth_{0};
+    int viewportHeight_{0};
+};
+
+} // namespace pacman::app
@@ -5,7 +5,6 @@
 #include "../world/World.h"
 
 #include "PacMan.h"
-#include "Wall.h"
 
 #include <array>
 #include <cmath>
@@ -117,6 +116,71 @@ void Ghost::resetToSpawn() noexcept {
     notify(e2);
 }
 
+/**
+ * @brief Overwrites movement state and mode from a saved snapshot without triggering mode side effects.
+ *
+ * Unlike setMode(), entering Fear here does not reverse the direction or rescale the speed.
+ *
+ * @param bounds Saved bounds.
+ * @param direction Saved direction.
+ * @param mode Saved mode.
+ * @param speed Saved movement speed.
+ */
+void Ghost::restore(const Rect& bounds, Direction direction, GhostMode mode, double speed) noexcept {
+    bounds_ = bounds;
+    mode_ = mode;
+    speed_ = speed;
+
+    StateChangedPayload modePayload{};
+    modePayload.code = (mode_ == GhostMode::Fear) ? 100 : 101;
+
+    Event e1{};
+    e1.type = EventType::StateChanged;
+    e1.payload = modePayload;
+    notify(e1);
+
+    direction_ = Direction::None;
+    setDirection(direction);
+
+    MovedPayload movedPayload{};
+    movedPayload.pos = {bounds_.x, bounds_.y};
+    movedPayload.size = {bounds_.w, bounds_.h};
+
+    Event e2{};
+    e2.type = EventType::Moved;
+    e2.payload = movedPayload;
+    notify(e2);
+}
+
+/**
+ * @brief Copies the movement state of a render snapshot, announcing only a changed direction or mode.
+ *
+ * Like restore(), entering Fear here has no side effects on direction or speed.
+ *
+ * @param bounds Snapshot bounds.
+ * @param direction Snapshot direction.
+ * @param mode Snapshot mode.
+ * @param speed Snapshot movement speed.
+ */
+void Ghost::applySnapshot(const Rect& bounds, Direction direction, GhostMode mode, double speed) noexcept {
+    bounds_ = bounds;
+    speed_ = speed;
+
+    if (mode_ != mode) {
+        mode_ = mode;
+
+        StateChangedPayload payload{};
+        payload.code = (mode_ == GhostMode::Fear) ? 100 : 101;
+
+        Event e{};
+        e.type = EventType::StateChanged;
+        e.payload = payload;
+        notify(e);
+    }
+
+    setDirection(direction);
+}
+
 /**
  * @brief Forces the current movement direction and emits a StateChanged event.
  * @param dir New movement direction.
@@ -159,6 +223,8 @@ void Ghost::setDirection(Direction dir) noexcept {
  * @return True if movement is allowed.
  */
 bool Ghost::isMoveViable(Direction d, double dt) const {
+    PACMAN_SIM_STAT(countStat(&SimStats::moveViabilityChecks));
+
     if (d == Direction::None || !world_) {
         return false;
     }
@@ -169,31 +235,7 @@ bool Ghost::isMoveViable(Direction d, double dt) const {
     next.x += dirToDx(d) * step;
     next.y += dirToDy(d) * step;
 
-    const auto& entities = world_->entities();
-
-    for (const auto& ent : entities) {
-        if (!ent || !ent->active || !ent->solid) {
-            continue;
-        }
-        if (ent.get() == this) {
-            continue;
-        }
-
-        auto* wall = dynamic_cast<Wall*>(ent.get());
-        if (!wall) {
-            continue;
-        }
-
-        if (wall == world_->ghostGate() && world_->canGhostPassGate(this)) {
-            continue;
-        }
-
-        if (intersects(next, wall->bounds(), 0.000128f)) {
-            return false;
-        }
-    }
-
-    return true;
+    return !world_->wallBlocks(next, 0.000128f, this);
 }
 
 /**
@@ -403,8 +445,10 @@ void Ghost::applyFearStrategy(double dt) {
     auto contains = [&](Direction d) { return std::find(viable.begin(), viable.end(), d) != viable.end(); };
 
     if (isCorridor && current != Direction::None && contains(current)) {
+        PACMAN_SIM_STAT(countStat(&SimStats::ghostDecisionsSkipped));
         return;
     }
+    PACMAN_SIM_STAT(countStat(&SimStats::ghostDecisions));
 
     std::vector<Direction> candidates;
     candidates.reserve(viable.size());
@@ -541,8 +585,10 @@ void Ghost::applyChaseStrategyA(double dt) {
     const bool isCorridor = (viable.size() == 2 && oppositeOf(viable[0]) == viable[1]);
 
     if (isCorridor && current != Direction::None && contains(current)) {
+        PACMAN_SIM_STAT(countStat(&SimStats::ghostDecisionsSkipped));
         return;
     }
+    PACMAN_SIM_STAT(countStat(&SimStats::ghostDecisions));
 
     const bool isChoice = isIntersectionOrCorner(viable);
     const bool currentViable = (current != Direction::None && contains(current));
@@ -597,8 +643,10 @@ Direction Ghost::chooseDirectionTowards(double dt, float tx, float ty) const {
     const bool isCorridor = (viable.size() == 2 && oppositeOf(viable[0]) == viable[1]);
 
     if (isCorridor && current != Direction::None && contains(current)) {
+        PACMAN_SIM_STAT(countStat(&SimStats::ghostDecisionsSkipped));
         return current;
     }
+    PACMAN_SIM_STAT(countStat(&SimStats::ghostDecisions));
 
     std::vector<Direction> candidates;
     for (Direction d : viable) {
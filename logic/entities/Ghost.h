@@ -93,6 +93,23 @@ public:
      */
     void setBounds(const Rect& bounds) noexcept { bounds_ = bounds; }
 
+    /**
+     * @brief Returns the bounds at the start of the last simulation step (for render interpolation).
+     * @return Bounding rectangle before the last update.
+     */
+    Rect previousBounds() const noexcept { return previousBounds_; }
+
+    /**
+     * @brief Records the current bounds as the start of the next simulation step.
+     */
+    void storePreviousBounds() noexcept { previousBounds_ = bounds_; }
+
+    /**
+     * @brief Overwrites the bounds at the start of the last simulation step (render-side copies of the world).
+     * @param bounds Bounding rectangle before the last update.
+     */
+    void setPreviousBounds(const Rect& bounds) noexcept { previousBounds_ = bounds; }
+
     /**
      * @brief Returns the original spawn bounds.
      * @return Spawn bounds.
@@ -104,6 +121,27 @@ public:
      */
     void resetToSpawn() noexcept;
 
+    /**
+     * @brief Overwrites movement state and mode from a saved snapshot without triggering mode side effects.
+     * @param bounds Saved bounds.
+     * @param direction Saved direction.
+     * @param mode Saved mode.
+     * @param speed Saved movement speed.
+     */
+    void restore(const Rect& bounds, Direction direction, GhostMode mode, double speed) noexcept;
+
+    /**
+     * @brief Copies the movement state of a render snapshot, announcing only a changed direction or mode.
+     *
+     * Views read the bounds from the model, so no Moved event is sent; a steady frame notifies nobody.
+     *
+     * @param bounds Snapshot bounds.
+     * @param direction Snapshot direction.
+     * @param mode Snapshot mode.
+     * @param speed Snapshot movement speed.
+     */
+    void applySnapshot(const Rect& bounds, Direction direction, GhostMode mode, double speed) noexcept;
+
     /**
      * @brief Returns the current ghost mode.
      * @return Current mode.
@@ -214,6 +252,7 @@ private:
 
 private:
     Rect bounds_{};
+    Rect previousBounds_{}; ///< Bounds before the last update (render-only, not part of WorldState)
     Rect spawnBounds_{};
 
     Direction direction_{Direction::None};
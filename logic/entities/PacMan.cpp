@@ -121,6 +121,46 @@ void PacMan::resetToSpawn() noexcept {
     notify(moved);
 }
 
+/**
+ * @brief Overwrites the movement state from a saved snapshot and re-announces it to observers.
+ * @param bounds Saved bounds.
+ * @param direction Saved applied direction.
+ * @param desired Saved desired direction.
+ * @param speed Saved movement speed.
+ */
+void PacMan::restore(const Rect& bounds, Direction direction, Direction desired, double speed) noexcept {
+    bounds_ = bounds;
+    desiredDirection_ = desired;
+    speed_ = speed;
+
+    direction_ = Direction::None;
+    setDirection(direction);
+
+    MovedPayload payload{};
+    payload.pos = {bounds_.x, bounds_.y};
+    payload.size = {bounds_.w, bounds_.h};
+
+    Event moved{};
+    moved.type = EventType::Moved;
+    moved.payload = payload;
+
+    notify(moved);
+}
+
+/**
+ * @brief Copies the movement state of a render snapshot, announcing only a changed direction.
+ * @param bounds Snapshot bounds.
+ * @param direction Snapshot applied direction.
+ * @param desired Snapshot desired direction.
+ * @param speed Snapshot movement speed.
+ */
+void PacMan::applySnapshot(const Rect& bounds, Direction direction, Direction desired, double speed) noexcept {
+    bounds_ = bounds;
+    desiredDirection_ = desired;
+    speed_ = speed;
+    setDirection(direction);
+}
+
 /**
  * @brief Emits a Died event with the configured death score value.
  */
@@ -90,6 +90,23 @@ public:
      */
     void setBounds(const Rect& bounds) noexcept { bounds_ = bounds; }
 
+    /**
+     * @brief Returns the bounds at the start of the last simulation step (for render interpolation).
+     * @return Bounding rectangle before the last update.
+     */
+    Rect previousBounds() const noexcept { return previousBounds_; }
+
+    /**
+     * @brief Records the current bounds as the start of the next simulation step.
+     */
+    void storePreviousBounds() noexcept { previousBounds_ = bounds_; }
+
+    /**
+     * @brief Overwrites the bounds at the start of the last simulation step (render-side copies of the world).
+     * @param bounds Bounding rectangle before the last update.
+     */
+    void setPreviousBounds(const Rect& bounds) noexcept { previousBounds_ = bounds; }
+
     /**
      * @brief Sets the spawn bounds used by resetToSpawn().
      * @param bounds New spawn bounding rectangle.
@@ -101,6 +118,27 @@ public:
      */
     void resetToSpawn() noexcept;
 
+    /**
+     * @brief Overwrites the movement state from a saved snapshot and re-announces it to observers.
+     * @param bounds Saved bounds.
+     * @param direction Saved applied direction.
+     * @param desired Saved desired direction.
+     * @param speed Saved movement speed.
+     */
+    void restore(const Rect& bounds, Direction direction, Direction desired, double speed) noexcept;
+
+    /**
+     * @brief Copies the movement state of a render snapshot, announcing only a changed direction.
+     *
+     * Views read the bounds from the model, so no Moved event is sent; a steady frame notifies nobody.
+     *
+     * @param bounds Snapshot bounds.
+     * @param direction Snapshot applied direction.
+     * @param desired Snapshot desired direction.
+     * @param speed Snapshot movement speed.
+     */
+    void applySnapshot(const Rect& bounds, Direction direction, Direction desired, double speed) noexcept;
+
     /**
      * @brief Emits a Died event with the configured death score value.
      */
@@ -108,6 +146,7 @@ public:
 
 private:
     Rect bounds_{};
+    Rect previousBounds_{}; ///< Bounds before the last update (render-only, not part of WorldState)
     Direction direction_{Direction::None};
     Direction desiredDirection_{Direction::Right};
 
@@ -0,0 +1,66 @@
+#include "ModelFactory.h"
+
+#include "../entities/Coin.h"
+#include "../entities/Fruit.h"
+#include "../entities/Ghost.h"
+#include "../entities/PacMan.h"
+#include "../entities/Wall.h"
+
+namespace pacman::logic {
+
+/**
+ * @brief Creates a PacMan model and attaches the score observer if set.
+ * @return Shared pointer to the created PacMan model.
+ */
+std::shared_ptr<PacMan> ModelFactory::createPacMan() {
+    auto model = std::make_shared<PacMan>(Rect{});
+    if (scoreObserver_) {
+        model->attach(scoreObserver_);
+    }
+    return model;
+}
+
+/**
+ * @brief Creates a Ghost model of the given kind and attaches the score observer if set.
+ * @param kind The ghost kind to create.
+ * @return Shared pointer to the created Ghost model.
+ */
+std::shared_ptr<Ghost> ModelFactory::createGhost(GhostKind kind) {
+    auto model = std::make_shared<Ghost>(Rect{}, kind);
+    if (scoreObserver_) {
+        model->attach(scoreObserver_);
+    }
+    return model;
+}
+
+/**
+ * @brief Creates a Coin model and attaches the score observer if set.
+ * @return Shared pointer to the created Coin model.
+ */
+std::shared_ptr<Coin> ModelFactory::createCoin() {
+    auto model = std::make_shared<Coin>(Rect{});
+    if (scoreObserver_) {
+        model->attach(scoreObserver_);
+    }
+    return model;
+}
+
+/**
+ * @brief Creates a Fruit model and attaches the score observer if set.
+ * @return Shared pointer to the created Fruit model.
+ */
+std::shared_ptr<Fruit> ModelFactory::createFruit() {
+    auto model = std::make_shared<Fruit>(Rect{});
+    if (scoreObserver_) {
+        model->attach(scoreObserver_);
+    }
+    return model;
+}
+
+/**
+ * @brief Creates a Wall model.
+ * @return Shared pointer to the created Wall model.
+ */
+std::shared_ptr<Wall> ModelFactory::createWall() { return std::make_shared<Wall>(Rect{}); }
+
+} // namespace pacman::logic
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "AbstractFactory.h"
+
+#include "../score/Score.h"
+
+#include <memory>
+
+namespace pacman::logic {
+
+/**
+ * @brief Factory that creates plain logic models without any views attached.
+ *
+ * Used for worlds that are simulated but not drawn directly, such as the authoritative world stepped on the
+ * simulation thread. Optionally attaches a score observer like the app-side factory does.
+ */
+class ModelFactory final : public AbstractFactory {
+public:
+    /**
+     * @brief Creates a PacMan model.
+     * @return Shared pointer to the created PacMan model.
+     */
+    std::shared_ptr<PacMan> createPacMan() override;
+
+    /**
+     * @brief Creates a Ghost model of the given kind.
+     * @param kind The ghost kind to create.
+     * @return Shared pointer to the created Ghost model.
+     */
+    std::shared_ptr<Ghost> createGhost(GhostKind kind) override;
+
+    /**
+     * @brief Creates a Coin model.
+     * @return Shared pointer to the created Coin model.
+     */
+    std::shared_ptr<Coin> createCoin() override;
+
+    /**
+     * @brief Creates a Fruit model.
+     * @return Shared pointer to the created Fruit model.
+     */
+    std::shared_ptr<Fruit> createFruit() override;
+
+    /**
+     * @brief Creates a Wall model.
+     * @return Shared pointer to the created Wall model.
+     */
+    std::shared_ptr<Wall> createWall() override;
+
+    /**
+     * @brief Sets the score observer that will be attached to newly created models where applicable.
+     * @param score Pointer to the score observer (not owned).
+     */
+    void setScoreObserver(Score* score) noexcept { scoreObserver_ = score; }
+
+private:
+    Score* scoreObserver_{nullptr};
+};
+
+} // namespace pacman::logic
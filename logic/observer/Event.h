@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <variant>
 
@@ -10,6 +11,29 @@ namespace pacman::logic {
  */
 enum class EventType : std::uint8_t { Tick, Moved, StateChanged, Collected, Died };
 
+inline constexpr std::size_t EventTypeCount = static_cast<std::size_t>(EventType::Died) + 1;
+
+/**
+ * @brief Returns a short lowercase name for an event type, for diagnostics.
+ * @param type Event type.
+ * @return Static name string.
+ */
+constexpr const char* eventTypeName(EventType type) noexcept {
+    switch (type) {
+    case EventType::Tick:
+        return "tick";
+    case EventType::Moved:
+        return "moved";
+    case EventType::StateChanged:
+        return "state";
+    case EventType::Collected:
+        return "collected";
+    case EventType::Died:
+        return "died";
+    }
+    return "?";
+}
+
 /**
  * @brief Simple 2D vector structure.
  */
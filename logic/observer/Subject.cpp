@@ -18,9 +18,17 @@ void Subject::detach(Observer* observer) {
 }
 
 void Subject::notify(const Event& event) {
-    const auto snapshot = observers_;
-    for (auto* observer : snapshot) {
-        if (observer) {
+#if defined(PACMAN_SIM_STATS)
+    if (stats_) {
+        ++stats_->events[static_cast<std::size_t>(event.type)];
+    }
+#endif
+
+    // Indexed over the observers registered when dispatch starts, so an observer attached by a handler is not
+    // called for this event; no copy of the list is made, so notifying never allocates.
+    const std::size_t count = observers_.size();
+    for (std::size_t i = 0; i < count && i < observers_.size(); ++i) {
+        if (Observer* observer = observers_[i]) {
             observer->onEvent(event);
         }
     }
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "../world/SimStats.h"
 #include "Observer.h"
 
 #include <algorithm>
@@ -27,15 +28,32 @@ public:
      */
     void detach(Observer* observer);
 
+    /**
+     * @brief Sets the statistics that notify() and subclasses count into.
+     * @param stats Statistics of the owning World, or nullptr to stop counting.
+     */
+    void setStats(SimStats* stats) noexcept { stats_ = stats; }
+
 protected:
     /**
-     * @brief Notifies all registered observers of an event.
+     * @brief Notifies all registered observers of an event without allocating.
      * @param event The event to dispatch.
      */
     void notify(const Event& event);
 
+    /**
+     * @brief Increments a SimStats counter if statistics are attached; wrap calls in PACMAN_SIM_STAT.
+     * @param counter Counter to increment.
+     */
+    void countStat(std::uint64_t SimStats::*counter) const noexcept {
+        if (stats_) {
+            ++(stats_->*counter);
+        }
+    }
+
 private:
     std::vector<Observer*> observers_;
+    SimStats* stats_{nullptr}; ///< Owned by the World this subject belongs to
 };
 
 } // namespace pacman::logic
\ No newline at end of file
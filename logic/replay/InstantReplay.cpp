@@ -0,0 +1,160 @@
+#include "InstantReplay.h"
+
+#include "../world/World.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace pacman::logic {
+
+namespace {
+/**
+ * @brief Appends the raw bytes of a trivially copyable value to a byte buffer.
+ * @param out Destination buffer.
+ * @param data Source bytes.
+ * @param size Number of bytes.
+ */
+void append(std::vector<std::byte>& out, const void* data, std::size_t size) {
+    const auto* bytes = static_cast<const std::byte*>(data);
+    out.insert(out.end(), bytes, bytes + size);
+}
+
+/**
+ * @brief Appends one record (header + payload) to a replay image.
+ * @param out Destination buffer.
+ * @param type Record type.
+ * @param tick Tick the record applies to.
+ * @param payload Payload bytes.
+ * @param size Payload size.
+ */
+void appendRecord(std::vector<std::byte>& out, replay::RecordType type, std::uint64_t tick, const void* payload,
+                  std::uint32_t size) {
+    ReplayRecordHeader record{};
+    record.type = static_cast<std::uint8_t>(type);
+    record.size = size;
+    record.tick = tick;
+
+    append(out, &record, sizeof(record));
+    append(out, payload, size);
+}
+} // namespace
+
+/**
+ * @brief Reserves the keyframe and input rings.
+ * @param keyframeInterval Ticks between keyframes.
+ * @param keyframes Number of keyframes kept (history covers roughly keyframes * interval ticks).
+ */
+InstantReplay::InstantReplay(std::uint32_t keyframeInterval, std::size_t keyframes)
+    : interval_(std::max<std::uint32_t>(1, keyframeInterval)) {
+    keyframes_.resize(std::max<std::size_t>(1, keyframes));
+    inputs_.resize(keyframes_.size() * interval_);
+}
+
+/**
+ * @brief Records the input for the upcoming tick and a keyframe when one is due.
+ * @param world World about to be updated.
+ * @param input Direction the controller applies this tick.
+ */
+void InstantReplay::recordTick(const World& world, Direction input) {
+    const std::uint64_t tick = world.tick();
+    if (keyframeCount_ > 0 && tick != nextTick_) {
+        clear();
+    }
+
+    if (keyframeCount_ == 0 || tick % interval_ == 0) {
+        const std::size_t slot = (keyframeCount_ == 0) ? 0 : (newestKeyframe_ + 1) % keyframes_.size();
+        if (!world.saveState(keyframes_[slot].state)) {
+            clear();
+            return;
+        }
+        keyframes_[slot].input = static_cast<std::uint8_t>(input);
+
+        if (keyframeCount_ == 0) {
+            firstTick_ = tick;
+        }
+        newestKeyframe_ = slot;
+        keyframeCount_ = std::min(keyframeCount_ + 1, keyframes_.size());
+    }
+
+    inputs_[tick % inputs_.size()] = static_cast<std::uint8_t>(input);
+    nextTick_ = tick + 1;
+    firstTick_ = std::max(firstTick_, nextTick_ - std::min<std::uint64_t>(nextTick_, inputs_.size()));
+}
+
+/**
+ * @brief Builds a replay image from the oldest usable keyframe up to the last recorded tick.
+ *
+ * The image holds one keyframe, the input changes after it, a one-entry index and the trailer.
+ *
+ * @param tickDt Fixed simulation step stored in the replay header.
+ * @param out Destination buffer (cleared first, capacity is reused).
+ * @return False if nothing has been recorded yet.
+ */
+bool InstantReplay::capture(double tickDt, std::vector<std::byte>& out) const {
+    out.clear();
+
+    const KeyframePayload* start = nullptr;
+    for (std::size_t i = 0; i < keyframeCount_; ++i) {
+        const std::size_t slot = (newestKeyframe_ + keyframes_.size() - i) % keyframes_.size();
+        if (keyframes_[slot].state.tick < firstTick_) {
+            break;
+        }
+        start = &keyframes_[slot];
+    }
+    if (!start) {
+        return false;
+    }
+
+    ReplayHeader header{};
+    header.tickDt = tickDt;
+    header.keyframeInterval = interval_;
+    append(out, &header, sizeof(header));
+
+    const std::uint64_t startTick = start->state.tick;
+    const ReplayIndexEntry entry{startTick, out.size()};
+    appendRecord(out, replay::RecordType::Keyframe, startTick, start, sizeof(KeyframePayload));
+
+    std::uint8_t last = start->input;
+    for (std::uint64_t tick = startTick + 1; tick < nextTick_; ++tick) {
+        const std::uint8_t input = inputs_[tick % inputs_.size()];
+        if (input == last) {
+            continue;
+        }
+
+        InputPayload payload{};
+        payload.direction = input;
+        appendRecord(out, replay::RecordType::Input, tick, &payload, sizeof(payload));
+        last = input;
+    }
+
+    ReplayTrailer trailer{};
+    trailer.indexOffset = out.size();
+    trailer.indexCount = 1;
+    trailer.endTick = nextTick_;
+
+    append(out, &entry, sizeof(entry));
+    append(out, &trailer, sizeof(trailer));
+    return true;
+}
+
+/**
+ * @brief Returns the largest image capture() can produce: one keyframe and an input change on every tick.
+ * @return Size in bytes.
+ */
+std::size_t InstantReplay::maxCaptureBytes() const noexcept {
+    return sizeof(ReplayHeader) + sizeof(ReplayRecordHeader) + sizeof(KeyframePayload) +
+           inputs_.size() * (sizeof(ReplayRecordHeader) + sizeof(InputPayload)) + sizeof(ReplayIndexEntry) +
+           sizeof(ReplayTrailer);
+}
+
+/**
+ * @brief Drops all recorded history.
+ */
+void InstantReplay::clear() noexcept {
+    keyframeCount_ = 0;
+    newestKeyframe_ = 0;
+    firstTick_ = 0;
+    nextTick_ = 0;
+}
+
+} // namespace pacman::logic
@@ -0,0 +1,77 @@
+#pragma once
+
+#include "../entities/Direction.h"
+#include "ReplayFormat.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace pacman::logic {
+
+class World;
+
+/**
+ * @brief Bounded in-memory history of recent inputs and keyframes for instant replays.
+ *
+ * Keeps a ring of the last few keyframes plus the input applied on every tick they cover. capture() turns the
+ * history into a self-contained replay image (same layout as a replay file), so it can be played back with
+ * ReplayReader/ReplayPlayer in a separate World while the recording world keeps running.
+ *
+ * Storage is reserved in the constructor; recordTick() does not allocate, and neither does capture() into a buffer
+ * reserved to maxCaptureBytes().
+ */
+class InstantReplay {
+public:
+    /**
+     * @brief Reserves the keyframe and input rings.
+     * @param keyframeInterval Ticks between keyframes.
+     * @param keyframes Number of keyframes kept (history covers roughly keyframes * interval ticks).
+     */
+    explicit InstantReplay(std::uint32_t keyframeInterval = 60, std::size_t keyframes = 6);
+
+    /**
+     * @brief Records the input for the upcoming tick and a keyframe when one is due.
+     *
+     * Must be called right before World::update(). A tick that does not follow the previous one (rewind, new
+     * game) discards the history first.
+     *
+     * @param world World about to be updated.
+     * @param input Direction the controller applies this tick.
+     */
+    void recordTick(const World& world, Direction input);
+
+    /**
+     * @brief Builds a replay image from the oldest usable keyframe up to the last recorded tick.
+     * @param tickDt Fixed simulation step stored in the replay header.
+     * @param out Destination buffer (cleared first, capacity is reused).
+     * @return False if nothing has been recorded yet.
+     */
+    bool capture(double tickDt, std::vector<std::byte>& out) const;
+
+    /**
+     * @brief Returns the largest image capture() can produce: one keyframe and an input change on every tick.
+     *
+     * Reserving this much in the destination buffer keeps capture() from allocating.
+     *
+     * @return Size in bytes.
+     */
+    std::size_t maxCaptureBytes() const noexcept;
+
+    /**
+     * @brief Drops all recorded history.
+     */
+    void clear() noexcept;
+
+private:
+    std::uint32_t interval_;
+    std::vector<KeyframePayload> keyframes_; ///< Ring, newest at newestKeyframe_
+    std::vector<std::uint8_t> inputs_;       ///< Ring indexed by tick % size
+
+    std::size_t keyframeCount_{0};
+    std::size_t newestKeyframe_{0};
+    std::uint64_t firstTick_{0}; ///< Oldest tick whose input is still stored
+    std::uint64_t nextTick_{0};  ///< Tick after the last recorded one
+};
+
+} // namespace pacman::logic
@@ -0,0 +1,116 @@
+#pragma once
+
+#include "../world/WorldState.h"
+
+#include <cstdint>
+#include <type_traits>
+
+namespace pacman::logic {
+
+namespace replay {
+
+inline constexpr std::uint32_t HeaderMagic = 0x50524D50;  ///< "PMRP"
+inline constexpr std::uint32_t TrailerMagic = 0x49524D50; ///< "PMRI"
+inline constexpr std::uint32_t Version = 1;
+
+/**
+ * @brief Kinds of records stored between header and index.
+ */
+enum class RecordType : std::uint8_t {
+    Input = 1,    ///< Payload: InputPayload
+    Keyframe = 2, ///< Payload: KeyframePayload
+    Track = 3     ///< Payload: TrackPayload
+};
+
+} // namespace replay
+
+/**
+ * @brief File header written once at offset 0.
+ *
+ * A replay is a flat binary file that can be mapped into memory and read without parsing it front to back:
+ *
+ *     ReplayHeader
+ *     record*             (ReplayRecordHeader + payload, 8-byte aligned, ordered by tick)
+ *     ReplayIndexEntry*   (one per keyframe, ordered by tick)
+ *     ReplayTrailer       (locates the index)
+ *
+ * Inputs are stored as changes only; keyframes carry a full WorldState every N ticks so a seek restores the
+ * nearest keyframe and re-simulates at most N ticks. Track records store Pac-Man's position every tick so it can
+ * be shown without simulating. Readers skip record types they do not handle. All values use the native byte order
+ * of the writer.
+ */
+struct ReplayHeader {
+    std::uint32_t magic{replay::HeaderMagic};
+    std::uint32_t version{replay::Version};
+    double tickDt{1.0 / 60.0};                   ///< Fixed simulation step in seconds
+    std::uint32_t keyframeInterval{300};         ///< Ticks between keyframes
+    std::uint32_t stateSize{sizeof(WorldState)}; ///< Guards against layout changes
+};
+
+/**
+ * @brief Header preceding every record payload.
+ */
+struct ReplayRecordHeader {
+    std::uint8_t type{0}; ///< replay::RecordType
+    std::uint8_t reserved[3]{};
+    std::uint32_t size{0}; ///< Payload size in bytes (multiple of 8)
+    std::uint64_t tick{0}; ///< World tick the record applies to (before that tick's update)
+};
+
+/**
+ * @brief Payload of an input record: the direction requested from this tick on.
+ */
+struct InputPayload {
+    std::uint8_t direction{0}; ///< Direction
+    std::uint8_t reserved[7]{};
+};
+
+/**
+ * @brief Payload of a track record: Pac-Man's bounds and facing at the record's tick.
+ */
+struct TrackPayload {
+    float x{0.0f};
+    float y{0.0f};
+    float w{0.0f};
+    float h{0.0f};
+    std::uint8_t direction{0}; ///< Direction
+    std::uint8_t active{0};
+    std::uint8_t reserved[6]{};
+};
+
+/**
+ * @brief Payload of a keyframe record: the input in effect plus the full world state.
+ */
+struct KeyframePayload {
+    std::uint8_t input{0}; ///< Direction in effect at this tick
+    std::uint8_t reserved[7]{};
+    WorldState state{};
+};
+
+/**
+ * @brief Footer index entry mapping a keyframe tick to its record offset.
+ */
+struct ReplayIndexEntry {
+    std::uint64_t tick{0};
+    std::uint64_t offset{0};
+};
+
+/**
+ * @brief Fixed-size trailer at the very end of the file.
+ */
+struct ReplayTrailer {
+    std::uint64_t indexOffset{0};
+    std::uint64_t indexCount{0};
+    std::uint64_t endTick{0}; ///< World tick after the last recorded update
+    std::uint32_t magic{replay::TrailerMagic};
+    std::uint32_t reserved{0};
+};
+
+static_assert(sizeof(ReplayHeader) % 8 == 0, "replay records must stay 8-byte aligned");
+static_assert(sizeof(ReplayRecordHeader) == 16, "unexpected record header size");
+static_assert(sizeof(InputPayload) % 8 == 0, "replay records must stay 8-byte aligned");
+static_assert(sizeof(TrackPayload) % 8 == 0, "replay records must stay 8-byte aligned");
+static_assert(sizeof(KeyframePayload) % 8 == 0, "replay records must stay 8-byte aligned");
+static_assert(std::is_trivially_copyable_v<KeyframePayload>, "keyframes are copied byte-wise");
+
+} // namespace pacman::logic
@@ -0,0 +1,127 @@
+#include "ReplayPlayer.h"
+
+#include "../utils/Random.h"
+#include "../world/World.h"
+
+#include <cstring>
+
+namespace pacman::logic {
+
+/**
+ * @brief Binds the player to a world and a replay.
+ * @param world World to drive (must outlive the player).
+ * @param reader Replay to play back (must outlive the player).
+ */
+ReplayPlayer::ReplayPlayer(World& world, const ReplayReader& reader) : world_(world), reader_(reader) {}
+
+/**
+ * @brief Restores the nearest keyframe at or before a tick and simulates forward to it.
+ *
+ * At most one keyframe interval is re-simulated, independent of how far into the replay the tick lies.
+ *
+ * @param tick Target tick.
+ * @return False if the replay is invalid or has no keyframe before the tick.
+ */
+bool ReplayPlayer::seek(std::uint64_t tick) {
+    ReplayIndexEntry entry{};
+    if (!reader_.findKeyframe(tick, entry)) {
+        return false;
+    }
+
+    ReplayRecordHeader header{};
+    const std::byte* payload = nullptr;
+    if (!reader_.readRecord(entry.offset, header, payload) || header.size != sizeof(KeyframePayload)) {
+        return false;
+    }
+
+    std::memcpy(&keyframe_, payload, sizeof(keyframe_));
+
+    auto& rng = Random::getInstance();
+    const auto outer = rng.engineState();
+
+    if (!world_.restoreState(keyframe_.state)) {
+        rng.setEngineState(outer);
+        return false;
+    }
+
+    input_ = static_cast<Direction>(keyframe_.input);
+    cursor_ = entry.offset + sizeof(ReplayRecordHeader) + header.size;
+    finished_ = false;
+
+    while (world_.tick() < tick && stepOnce()) {
+    }
+
+    rng_ = rng.engineState();
+    rng.setEngineState(outer);
+    return true;
+}
+
+/**
+ * @brief Simulates up to the given number of ticks.
+ * @param ticks Number of ticks to simulate.
+ * @return Number of ticks actually simulated (less at the end of the replay).
+ */
+std::uint64_t ReplayPlayer::advance(std::uint64_t ticks) {
+    if (finished_ || ticks == 0) {
+        return 0;
+    }
+
+    auto& rng = Random::getInstance();
+    const auto outer = rng.engineState();
+    rng.setEngineState(rng_);
+
+    std::uint64_t done = 0;
+    while (done < ticks && stepOnce()) {
+        ++done;
+    }
+
+    rng_ = rng.engineState();
+    rng.setEngineState(outer);
+    return done;
+}
+
+/**
+ * @brief Applies the records for the current tick and simulates one step.
+ * @return False if playback has ended.
+ */
+bool ReplayPlayer::stepOnce() {
+    if (finished_ || world_.tick() >= reader_.endTick()) {
+        finished_ = true;
+        return false;
+    }
+
+    ReplayRecordHeader header{};
+    const std::byte* payload = nullptr;
+    while (reader_.readRecord(cursor_, header, payload) && header.tick <= world_.tick()) {
+        if (header.type == static_cast<std::uint8_t>(replay::RecordType::Input) &&
+            header.size >= sizeof(InputPayload)) {
+            InputPayload in{};
+            std::memcpy(&in, payload, sizeof(in));
+            input_ = static_cast<Direction>(in.direction);
+        }
+        cursor_ += sizeof(ReplayRecordHeader) + header.size;
+    }
+
+    if (input_ != Direction::None) {
+        world_.setPacManDirection(input_);
+    }
+
+    if (world_.isGameOver()) {
+        finished_ = true;
+        return false;
+    }
+
+    world_.update(reader_.header().tickDt);
+
+    if (world_.isLevelCleared()) {
+        if (levelAdvanceHook_) {
+            levelAdvanceHook_();
+        }
+        world_.advanceLevel();
+        input_ = Direction::None;
+    }
+
+    return true;
+}
+
+} // namespace pacman::logic
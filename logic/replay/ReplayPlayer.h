@@ -0,0 +1,88 @@
+#pragma once
+
+#include "../entities/Direction.h"
+#include "ReplayReader.h"
+
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <utility>
+
+namespace pacman::logic {
+
+class World;
+
+/**
+ * @brief Re-simulates a recorded replay in a World, with keyframe-based seeking.
+ *
+ * The world must have the replay's tile map loaded. Playback mirrors the level controller: apply the
+ * recorded direction, update with the recorded step, and advance the level once it is cleared.
+ * The player keeps its own Random engine and swaps it in only while simulating, so the global generator
+ * seen by other worlds is left untouched.
+ */
+class ReplayPlayer {
+public:
+    /**
+     * @brief Binds the player to a world and a replay.
+     * @param world World to drive (must outlive the player).
+     * @param reader Replay to play back (must outlive the player).
+     */
+    ReplayPlayer(World& world, const ReplayReader& reader);
+
+    /**
+     * @brief Restores the nearest keyframe at or before a tick and simulates forward to it.
+     * @param tick Target tick.
+     * @return False if the replay is invalid or has no keyframe before the tick.
+     */
+    bool seek(std::uint64_t tick);
+
+    /**
+     * @brief Simulates up to the given number of ticks.
+     * @param ticks Number of ticks to simulate.
+     * @return Number of ticks actually simulated (less at the end of the replay).
+     */
+    std::uint64_t advance(std::uint64_t ticks);
+
+    /**
+     * @brief Sets a callback invoked right before playback advances the world to the next level.
+     *
+     * Lets the caller drop views of the entities that are about to be replaced, as the level controller does.
+     *
+     * @param hook Callback (may be empty).
+     */
+    void setLevelAdvanceHook(std::function<void()> hook) { levelAdvanceHook_ = std::move(hook); }
+
+    /**
+     * @brief Returns whether playback reached the end of the recording or a game over.
+     * @return True if no more ticks can be simulated.
+     */
+    bool finished() const noexcept { return finished_; }
+
+    /**
+     * @brief Returns the direction currently applied by playback.
+     * @return Current input.
+     */
+    Direction input() const noexcept { return input_; }
+
+private:
+    /**
+     * @brief Applies the records for the current tick and simulates one step.
+     * @return False if playback has ended.
+     */
+    bool stepOnce();
+
+private:
+    World& world_;
+    const ReplayReader& reader_;
+
+    std::uint64_t cursor_{0};
+    Direction input_{Direction::None};
+    bool finished_{true};
+
+    std::function<void()> levelAdvanceHook_;
+
+    std::mt19937 rng_{};
+    KeyframePayload keyframe_{};
+};
+
+} // namespace pacman::logic
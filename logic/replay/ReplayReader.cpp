@@ -0,0 +1,98 @@
+#include "ReplayReader.h"
+
+#include <cstring>
+
+namespace pacman::logic {
+
+/**
+ * @brief Validates header and trailer of a replay image.
+ * @param data First byte of the replay.
+ * @param size Size of the replay in bytes.
+ */
+ReplayReader::ReplayReader(const std::byte* data, std::size_t size) : data_(data), size_(size) {
+    if (!data_ || size_ < sizeof(ReplayHeader) + sizeof(ReplayTrailer)) {
+        return;
+    }
+
+    std::memcpy(&header_, data_, sizeof(header_));
+    std::memcpy(&trailer_, data_ + size_ - sizeof(trailer_), sizeof(trailer_));
+
+    if (header_.magic != replay::HeaderMagic || header_.version != replay::Version ||
+        header_.stateSize != sizeof(WorldState) || trailer_.magic != replay::TrailerMagic) {
+        return;
+    }
+
+    // Bound offset and count before multiplying, so a crafted trailer cannot wrap the index size around.
+    const std::uint64_t indexEnd = size_ - sizeof(ReplayTrailer);
+    if (trailer_.indexOffset < sizeof(ReplayHeader) || trailer_.indexOffset > indexEnd ||
+        trailer_.indexCount > (indexEnd - trailer_.indexOffset) / sizeof(ReplayIndexEntry) ||
+        trailer_.indexOffset + trailer_.indexCount * sizeof(ReplayIndexEntry) != indexEnd) {
+        return;
+    }
+
+    valid_ = true;
+}
+
+/**
+ * @brief Reads the index entry at the given position.
+ * @param i Entry position.
+ * @return Index entry.
+ */
+ReplayIndexEntry ReplayReader::entry(std::size_t i) const {
+    ReplayIndexEntry e{};
+    std::memcpy(&e, data_ + trailer_.indexOffset + i * sizeof(ReplayIndexEntry), sizeof(e));
+    return e;
+}
+
+/**
+ * @brief Finds the last keyframe at or before a tick using a binary search over the index.
+ * @param tick Target tick.
+ * @param out Receives the index entry.
+ * @return False if no keyframe precedes the tick.
+ */
+bool ReplayReader::findKeyframe(std::uint64_t tick, ReplayIndexEntry& out) const {
+    if (!valid_ || trailer_.indexCount == 0) {
+        return false;
+    }
+
+    std::size_t lo = 0;
+    std::size_t hi = keyframeCount();
+    while (lo < hi) {
+        const std::size_t mid = lo + (hi - lo) / 2;
+        if (entry(mid).tick <= tick) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+
+    if (lo == 0) {
+        return false;
+    }
+
+    out = entry(lo - 1);
+    return true;
+}
+
+/**
+ * @brief Reads the record starting at a given offset.
+ * @param offset Byte offset of the record header.
+ * @param header Receives the record header.
+ * @param payload Receives a pointer to the payload bytes.
+ * @return False if the offset is past the last record or the record is truncated.
+ */
+bool ReplayReader::readRecord(std::uint64_t offset, ReplayRecordHeader& header, const std::byte*& payload) const {
+    if (!valid_ || offset + sizeof(ReplayRecordHeader) > recordsEnd()) {
+        return false;
+    }
+
+    std::memcpy(&header, data_ + offset, sizeof(header));
+    if (offset + sizeof(ReplayRecordHeader) + header.size > recordsEnd()) {
+        return false;
+    }
+
+    payload = data_ + offset + sizeof(ReplayRecordHeader);
+    return true;
+}
+
+} // namespace pacman::logic
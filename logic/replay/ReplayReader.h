@@ -0,0 +1,95 @@
+#pragma once
+
+#include "ReplayFormat.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace pacman::logic {
+
+/**
+ * @brief Zero-copy reader over a replay image in memory (typically a MappedFile).
+ *
+ * Only the header and trailer are inspected on construction; records and index entries are read lazily,
+ * so opening a long replay costs the same as opening a short one.
+ */
+class ReplayReader {
+public:
+    /**
+     * @brief Validates header and trailer of a replay image.
+     * @param data First byte of the replay.
+     * @param size Size of the replay in bytes.
+     */
+    ReplayReader(const std::byte* data, std::size_t size);
+
+    /**
+     * @brief Returns whether header, trailer and index are consistent.
+     * @return True if the replay can be read.
+     */
+    bool isValid() const noexcept { return valid_; }
+
+    /**
+     * @brief Returns the replay header.
+     * @return Header as written by ReplayWriter.
+     */
+    const ReplayHeader& header() const noexcept { return header_; }
+
+    /**
+     * @brief Returns the world tick after the last recorded update.
+     * @return End tick.
+     */
+    std::uint64_t endTick() const noexcept { return trailer_.endTick; }
+
+    /**
+     * @brief Returns the number of keyframes in the index.
+     * @return Keyframe count.
+     */
+    std::size_t keyframeCount() const noexcept { return static_cast<std::size_t>(trailer_.indexCount); }
+
+    /**
+     * @brief Finds the last keyframe at or before a tick using a binary search over the index.
+     * @param tick Target tick.
+     * @param out Receives the index entry.
+     * @return False if no keyframe precedes the tick.
+     */
+    bool findKeyframe(std::uint64_t tick, ReplayIndexEntry& out) const;
+
+    /**
+     * @brief Returns the offset of the first record.
+     * @return Byte offset.
+     */
+    std::uint64_t recordsBegin() const noexcept { return sizeof(ReplayHeader); }
+
+    /**
+     * @brief Returns the offset just past the last record.
+     * @return Byte offset.
+     */
+    std::uint64_t recordsEnd() const noexcept { return trailer_.indexOffset; }
+
+    /**
+     * @brief Reads the record starting at a given offset.
+     * @param offset Byte offset of the record header.
+     * @param header Receives the record header.
+     * @param payload Receives a pointer to the payload bytes.
+     * @return False if the offset is past the last record or the record is truncated.
+     */
+    bool readRecord(std::uint64_t offset, ReplayRecordHeader& header, const std::byte*& payload) const;
+
+private:
+    /**
+     * @brief Reads the index entry at the given position.
+     * @param i Entry position.
+     * @return Index entry.
+     */
+    ReplayIndexEntry entry(std::size_t i) const;
+
+private:
+    const std::byte* data_{nullptr};
+    std::size_t size_{0};
+
+    ReplayHeader header_{};
+    ReplayTrailer trailer_{};
+    bool valid_{false};
+};
+
+} // namespace pacman::logic
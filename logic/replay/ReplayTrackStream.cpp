@@ -0,0 +1,149 @@
+#include "ReplayTrackStream.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace pacman::logic {
+
+/**
+ * @brief Opens a replay file and validates its header and trailer.
+ * @param path Replay file path.
+ */
+ReplayTrackStream::ReplayTrackStream(const std::string& path) : in_(path, std::ios::binary) {
+    if (!in_) {
+        return;
+    }
+
+    ReplayHeader header{};
+    ReplayTrailer trailer{};
+
+    in_.seekg(0, std::ios::end);
+    const auto size = static_cast<std::uint64_t>(in_.tellg());
+    if (size < sizeof(header) + sizeof(trailer)) {
+        return;
+    }
+
+    in_.seekg(0);
+    in_.read(reinterpret_cast<char*>(&header), sizeof(header));
+    in_.seekg(static_cast<std::streamoff>(size - sizeof(trailer)));
+    in_.read(reinterpret_cast<char*>(&trailer), sizeof(trailer));
+
+    if (!in_ || header.magic != replay::HeaderMagic || header.version != replay::Version ||
+        trailer.magic != replay::TrailerMagic || trailer.indexOffset < sizeof(header) || trailer.indexOffset > size) {
+        return;
+    }
+
+    recordsEnd_ = trailer.indexOffset;
+    endTick_ = trailer.endTick;
+    valid_ = true;
+
+    restart();
+}
+
+/**
+ * @brief Returns the latest track sample at or before a tick.
+ * @param tick World tick to sample.
+ * @param out Receives the sample.
+ * @return False if no sample exists at or before the tick or the track has ended.
+ */
+bool ReplayTrackStream::sampleAt(std::uint64_t tick, TrackPayload& out) {
+    if (!valid_ || tick >= endTick_) {
+        return false;
+    }
+    if (hasCurrent_ && tick < currentTick_) {
+        restart();
+    }
+
+    ReplayRecordHeader header{};
+    while (fill(sizeof(header))) {
+        std::memcpy(&header, chunk_.data() + begin_, sizeof(header));
+        if (header.tick > tick) {
+            break;
+        }
+
+        if (header.type == static_cast<std::uint8_t>(replay::RecordType::Track) &&
+            header.size == sizeof(TrackPayload)) {
+            if (!fill(sizeof(header) + sizeof(TrackPayload))) {
+                break;
+            }
+            std::memcpy(&current_, chunk_.data() + begin_ + sizeof(header), sizeof(TrackPayload));
+            currentTick_ = header.tick;
+            hasCurrent_ = true;
+        }
+
+        skip(sizeof(header) + header.size);
+    }
+
+    if (!hasCurrent_) {
+        return false;
+    }
+
+    out = current_;
+    return true;
+}
+
+/**
+ * @brief Repositions the stream at the first record.
+ */
+void ReplayTrackStream::restart() {
+    in_.clear();
+    in_.seekg(static_cast<std::streamoff>(sizeof(ReplayHeader)));
+
+    begin_ = 0;
+    end_ = 0;
+    fileOffset_ = sizeof(ReplayHeader);
+    hasCurrent_ = false;
+    currentTick_ = 0;
+}
+
+/**
+ * @brief Makes at least the given number of bytes available in the buffer.
+ *
+ * Unread bytes are moved to the front of the buffer and the rest is refilled with one read, never past the
+ * end of the records.
+ *
+ * @param bytes Required contiguous bytes.
+ * @return False if the records end first.
+ */
+bool ReplayTrackStream::fill(std::size_t bytes) {
+    if (end_ - begin_ >= bytes) {
+        return true;
+    }
+
+    const std::size_t buffered = end_ - begin_;
+    std::memmove(chunk_.data(), chunk_.data() + begin_, buffered);
+    begin_ = 0;
+    end_ = buffered;
+
+    const std::uint64_t remaining = recordsEnd_ - fileOffset_;
+    const auto want = static_cast<std::size_t>(std::min<std::uint64_t>(chunk_.size() - end_, remaining));
+    if (want > 0) {
+        in_.read(reinterpret_cast<char*>(chunk_.data() + end_), static_cast<std::streamsize>(want));
+        const auto got = static_cast<std::size_t>(in_.gcount());
+        end_ += got;
+        fileOffset_ += got;
+    }
+
+    return end_ - begin_ >= bytes;
+}
+
+/**
+ * @brief Drops the given number of bytes, seeking past whatever is not buffered.
+ * @param bytes Bytes to skip.
+ */
+void ReplayTrackStream::skip(std::uint64_t bytes) {
+    const std::size_t buffered = end_ - begin_;
+    if (bytes <= buffered) {
+        begin_ += static_cast<std::size_t>(bytes);
+        return;
+    }
+
+    const std::uint64_t rest = std::min(bytes - buffered, recordsEnd_ - fileOffset_);
+    begin_ = 0;
+    end_ = 0;
+
+    in_.seekg(static_cast<std::streamoff>(rest), std::ios::cur);
+    fileOffset_ += rest;
+}
+
+} // namespace pacman::logic
@@ -0,0 +1,83 @@
+#pragma once
+
+#include "ReplayFormat.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+
+namespace pacman::logic {
+
+/**
+ * @brief Forward-only reader of the Pac-Man track stored in a replay file.
+ *
+ * The file is streamed through a small fixed buffer and decoded on demand: each call to sampleAt() consumes only
+ * the records up to the requested tick, skipping keyframes with a seek instead of reading them. Nothing beyond
+ * the buffer is held in memory, so arbitrarily long replays cost the same as short ones.
+ */
+class ReplayTrackStream {
+public:
+    /**
+     * @brief Opens a replay file and validates its header and trailer.
+     * @param path Replay file path.
+     */
+    explicit ReplayTrackStream(const std::string& path);
+
+    /**
+     * @brief Returns whether the file is a readable replay.
+     * @return True if samples can be read.
+     */
+    bool isOpen() const noexcept { return valid_; }
+
+    /**
+     * @brief Returns the latest track sample at or before a tick.
+     *
+     * Ticks are expected to increase between calls; asking for an earlier tick restarts the stream.
+     *
+     * @param tick World tick to sample.
+     * @param out Receives the sample.
+     * @return False if no sample exists at or before the tick or the track has ended.
+     */
+    bool sampleAt(std::uint64_t tick, TrackPayload& out);
+
+private:
+    /**
+     * @brief Repositions the stream at the first record.
+     */
+    void restart();
+
+    /**
+     * @brief Makes at least the given number of bytes available in the buffer.
+     * @param bytes Required contiguous bytes.
+     * @return False if the records end first.
+     */
+    bool fill(std::size_t bytes);
+
+    /**
+     * @brief Drops the given number of bytes, seeking past whatever is not buffered.
+     * @param bytes Bytes to skip.
+     */
+    void skip(std::uint64_t bytes);
+
+private:
+    static constexpr std::size_t ChunkSize = 4096;
+
+    std::ifstream in_;
+    bool valid_{false};
+
+    std::array<std::byte, ChunkSize> chunk_{};
+    std::size_t begin_{0}; ///< First unread byte in chunk_
+    std::size_t end_{0};   ///< One past the last buffered byte
+
+    std::uint64_t fileOffset_{0}; ///< File offset of chunk_[end_]
+    std::uint64_t recordsEnd_{0}; ///< File offset of the index (end of records)
+    std::uint64_t endTick_{0};
+
+    TrackPayload current_{};
+    std::uint64_t currentTick_{0};
+    bool hasCurrent_{false};
+};
+
+} // namespace pacman::logic
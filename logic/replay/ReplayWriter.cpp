@@ -0,0 +1,218 @@
+#include "ReplayWriter.h"
+
+#include "../entities/PacMan.h"
+#include "../world/World.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <utility>
+
+namespace pacman::logic {
+
+/**
+ * @brief Opens the replay file, starts the writer thread and queues the header.
+ *
+ * If the file cannot be opened the writer stays closed and all calls become no-ops.
+ *
+ * @param path Destination file path.
+ * @param tickDt Fixed simulation step in seconds.
+ * @param keyframeSeconds Simulated seconds between keyframes.
+ */
+ReplayWriter::ReplayWriter(const std::string& path, double tickDt, double keyframeSeconds)
+    : out_(path, std::ios::binary | std::ios::trunc) {
+    if (!out_) {
+        out_.close();
+        return;
+    }
+    open_ = true;
+
+    header_.tickDt = tickDt;
+
+    const double ticks = (tickDt > 0.0) ? std::round(keyframeSeconds / tickDt) : 1.0;
+    header_.keyframeInterval = static_cast<std::uint32_t>(std::max(1.0, ticks));
+
+    pending_.reserve(HandOffBytes + sizeof(ReplayRecordHeader) + sizeof(KeyframePayload));
+    append(&header_, sizeof(header_));
+    offset_ = sizeof(header_);
+
+    thread_ = std::thread([this] { run(); });
+}
+
+/**
+ * @brief Finishes the file if that has not happened yet.
+ */
+ReplayWriter::~ReplayWriter() { finish(); }
+
+/**
+ * @brief Records the input for the upcoming tick and a keyframe when one is due.
+ *
+ * Inputs are only written when they change; Pac-Man's position is tracked every tick. A keyframe is written on
+ * the first recorded tick and on every multiple of the keyframe interval; it carries the input in effect, so
+ * playback can start from it without earlier records. Recording may therefore start at any tick (e.g. after a
+ * rewind).
+ *
+ * @param world World about to be updated.
+ * @param input Direction the controller applies this tick (None if nothing is requested).
+ */
+void ReplayWriter::recordTick(const World& world, Direction input) {
+    if (!isOpen()) {
+        return;
+    }
+
+    const std::uint64_t tick = world.tick();
+    endTick_ = tick + 1;
+
+    if (!hasInput_ || input != lastInput_) {
+        InputPayload payload{};
+        payload.direction = static_cast<std::uint8_t>(input);
+        writeRecord(replay::RecordType::Input, tick, &payload, sizeof(payload));
+
+        lastInput_ = input;
+        hasInput_ = true;
+    }
+
+    if (const PacMan* pac = world.pacMan()) {
+        const Rect b = pac->bounds();
+
+        TrackPayload track{};
+        track.x = b.x;
+        track.y = b.y;
+        track.w = b.w;
+        track.h = b.h;
+        track.direction = static_cast<std::uint8_t>(pac->direction());
+        track.active = pac->active ? 1 : 0;
+        writeRecord(replay::RecordType::Track, tick, &track, sizeof(track));
+    }
+
+    if (!index_.empty() && tick % header_.keyframeInterval != 0) {
+        return;
+    }
+    if (!index_.empty() && index_.back().tick == tick) {
+        return;
+    }
+    if (!world.saveState(keyframe_.state)) {
+        return;
+    }
+
+    keyframe_.input = static_cast<std::uint8_t>(input);
+
+    index_.push_back(ReplayIndexEntry{tick, offset_});
+    writeRecord(replay::RecordType::Keyframe, tick, &keyframe_, sizeof(keyframe_));
+    handOff();
+}
+
+/**
+ * @brief Appends one record (header + payload) to the pending chunk and advances the write offset.
+ *
+ * The chunk is handed off once it reaches HandOffBytes.
+ *
+ * @param type Record type.
+ * @param tick Tick the record applies to.
+ * @param payload Pointer to the payload bytes.
+ * @param size Payload size in bytes.
+ */
+void ReplayWriter::writeRecord(replay::RecordType type, std::uint64_t tick, const void* payload, std::uint32_t size) {
+    ReplayRecordHeader record{};
+    record.type = static_cast<std::uint8_t>(type);
+    record.size = size;
+    record.tick = tick;
+
+    append(&record, sizeof(record));
+    append(payload, size);
+    offset_ += sizeof(record) + size;
+
+    if (pending_.size() >= HandOffBytes) {
+        handOff();
+    }
+}
+
+/**
+ * @brief Appends raw bytes to the pending chunk.
+ * @param data Bytes to append.
+ * @param size Number of bytes.
+ */
+void ReplayWriter::append(const void* data, std::size_t size) {
+    if (size == 0) {
+        return;
+    }
+
+    const std::size_t at = pending_.size();
+    pending_.resize(at + size);
+    std::memcpy(pending_.data() + at, data, size);
+}
+
+/**
+ * @brief Queues the pending chunk for the writer thread and continues in a spare buffer.
+ */
+void ReplayWriter::handOff() {
+    if (pending_.empty()) {
+        return;
+    }
+
+    {
+        std::scoped_lock lock(mtx_);
+        queue_.push_back(std::move(pending_));
+        if (!spare_.empty()) {
+            pending_ = std::move(spare_.back());
+            spare_.pop_back();
+        } else {
+            pending_ = {};
+            pending_.reserve(HandOffBytes + sizeof(ReplayRecordHeader) + sizeof(KeyframePayload));
+        }
+    }
+    cv_.notify_one();
+}
+
+/**
+ * @brief Writer thread body: writes queued chunks in order until finish() stops it and the queue is empty.
+ */
+void ReplayWriter::run() {
+    std::unique_lock lock(mtx_);
+    for (;;) {
+        cv_.wait(lock, [this] { return stop_ || !queue_.empty(); });
+        if (queue_.empty()) {
+            return;
+        }
+
+        std::vector<char> chunk = std::move(queue_.front());
+        queue_.pop_front();
+
+        lock.unlock();
+        out_.write(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+        chunk.clear();
+        lock.lock();
+
+        spare_.push_back(std::move(chunk));
+    }
+}
+
+/**
+ * @brief Writes the keyframe index and trailer, waits for the writer thread and closes the file.
+ */
+void ReplayWriter::finish() {
+    if (!isOpen()) {
+        return;
+    }
+    open_ = false;
+
+    ReplayTrailer trailer{};
+    trailer.indexOffset = offset_;
+    trailer.indexCount = index_.size();
+    trailer.endTick = endTick_;
+
+    append(index_.data(), index_.size() * sizeof(ReplayIndexEntry));
+    append(&trailer, sizeof(trailer));
+    handOff();
+
+    {
+        std::scoped_lock lock(mtx_);
+        stop_ = true;
+    }
+    cv_.notify_one();
+    thread_.join();
+
+    out_.close();
+}
+
+} // namespace pacman::logic
@@ -0,0 +1,119 @@
+#pragma once
+
+#include "../entities/Direction.h"
+#include "ReplayFormat.h"
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace pacman::logic {
+
+class World;
+
+/**
+ * @brief Streams a replay (input changes, Pac-Man track, periodic keyframes) to disk while a level is played.
+ *
+ * recordTick() must be called once per simulation step, right before World::update(), with the
+ * direction the controller is about to apply. The keyframe index and trailer are written by finish().
+ *
+ * Records are encoded in memory on the recording thread and handed to a writer thread in chunks (after every
+ * keyframe and whenever HandOffBytes have built up), so a simulation thread never waits on the file system.
+ * Written chunks are handed back for reuse. finish() waits until everything is on disk.
+ */
+class ReplayWriter {
+public:
+    static constexpr std::size_t HandOffBytes = 16 * 1024; ///< Encoded bytes after which a chunk is handed off
+
+    /**
+     * @brief Opens the replay file, starts the writer thread and queues the header.
+     * @param path Destination file path.
+     * @param tickDt Fixed simulation step in seconds.
+     * @param keyframeSeconds Simulated seconds between keyframes.
+     */
+    ReplayWriter(const std::string& path, double tickDt, double keyframeSeconds = 5.0);
+
+    /**
+     * @brief Finishes the file if that has not happened yet.
+     */
+    ~ReplayWriter();
+
+    ReplayWriter(const ReplayWriter&) = delete;
+    ReplayWriter& operator=(const ReplayWriter&) = delete;
+
+    /**
+     * @brief Returns whether records are accepted.
+     * @return False if the file could not be opened or finish() already ran.
+     */
+    bool isOpen() const noexcept { return open_; }
+
+    /**
+     * @brief Records the input for the upcoming tick and a keyframe when one is due.
+     * @param world World about to be updated.
+     * @param input Direction the controller applies this tick (None if nothing is requested).
+     */
+    void recordTick(const World& world, Direction input);
+
+    /**
+     * @brief Writes the keyframe index and trailer, waits for the writer thread and closes the file.
+     */
+    void finish();
+
+private:
+    /**
+     * @brief Appends one record (header + payload) to the pending chunk and advances the write offset.
+     * @param type Record type.
+     * @param tick Tick the record applies to.
+     * @param payload Pointer to the payload bytes.
+     * @param size Payload size in bytes.
+     */
+    void writeRecord(replay::RecordType type, std::uint64_t tick, const void* payload, std::uint32_t size);
+
+    /**
+     * @brief Appends raw bytes to the pending chunk.
+     * @param data Bytes to append.
+     * @param size Number of bytes.
+     */
+    void append(const void* data, std::size_t size);
+
+    /**
+     * @brief Queues the pending chunk for the writer thread and continues in a spare buffer.
+     */
+    void handOff();
+
+    /**
+     * @brief Writer thread body: writes queued chunks in order until finish() stops it.
+     */
+    void run();
+
+private:
+    std::ofstream out_; ///< Only touched by the writer thread once it runs
+    bool open_{false};
+    std::uint64_t offset_{0};
+    std::vector<char> pending_; ///< Records not yet handed off (recording thread)
+
+    ReplayHeader header_{};
+    std::vector<ReplayIndexEntry> index_;
+
+    std::uint64_t endTick_{0};
+    Direction lastInput_{Direction::None};
+    bool hasInput_{false};
+
+    KeyframePayload keyframe_{};
+
+    std::mutex mtx_;
+    std::condition_variable cv_;
+    std::deque<std::vector<char>> queue_;  ///< Chunks waiting to be written, oldest first
+    std::vector<std::vector<char>> spare_; ///< Written chunks, reused by handOff()
+    bool stop_{false};
+
+    std::thread thread_; ///< Writer thread, started once the file is open
+};
+
+} // namespace pacman::logic
@@ -0,0 +1,264 @@
+#include "RewindBuffer.h"
+
+#include "../score/Score.h"
+#include "../world/World.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace pacman::logic {
+
+namespace {
+constexpr std::size_t kMaxRun = 0xFFFF;   ///< Largest run length a token can hold
+constexpr std::size_t kMinZeroRun = 4;    ///< Shorter zero runs stay inside a literal run
+constexpr std::size_t kTokenSize = 4;     ///< u16 zero run + u16 literal count
+constexpr std::size_t kFrameSize = sizeof(RewindFrame);
+constexpr std::size_t kMaxEncoded = kFrameSize + kTokenSize * (kFrameSize / kMaxRun + 2);
+
+/**
+ * @brief Writes a 16-bit value in native byte order.
+ * @param out Destination.
+ * @param value Value to write.
+ */
+void putU16(unsigned char* out, std::size_t value) {
+    const auto v = static_cast<std::uint16_t>(value);
+    std::memcpy(out, &v, sizeof(v));
+}
+
+/**
+ * @brief Reads a 16-bit value in native byte order.
+ * @param in Source.
+ * @return Value read.
+ */
+std::size_t getU16(const unsigned char* in) {
+    std::uint16_t v = 0;
+    std::memcpy(&v, in, sizeof(v));
+    return v;
+}
+} // namespace
+
+/**
+ * @brief Reserves all storage up front.
+ *
+ * The delta ring receives whatever remains of the budget after the two full frames, the encoder scratch buffer
+ * and the slot index, but never less than one worst-case delta.
+ *
+ * @param budgetBytes Total memory budget including the full frames and the index.
+ * @param maxFrames Maximum number of frames that can be stepped back over.
+ */
+RewindBuffer::RewindBuffer(std::size_t budgetBytes, std::size_t maxFrames) {
+    maxFrames = std::max<std::size_t>(1, maxFrames);
+
+    const std::size_t fixed = 2 * kFrameSize + kMaxEncoded + maxFrames * sizeof(Slot);
+    const std::size_t ring = (budgetBytes > fixed) ? budgetBytes - fixed : 0;
+
+    bytes_.resize(std::max(ring, kMaxEncoded));
+    scratch_.resize(kMaxEncoded);
+    slots_.resize(maxFrames);
+}
+
+/**
+ * @brief Creates a buffer that holds a span of simulated time at the given tick length.
+ *
+ * The span is rounded to whole ticks, matching how LevelState converts a rewind request into frames.
+ *
+ * @param tickDt Simulation tick length in seconds.
+ * @param seconds Simulated time to keep.
+ * @return Buffer sized for the span.
+ */
+RewindBuffer RewindBuffer::forTickRate(double tickDt, double seconds) {
+    const auto frames = static_cast<std::size_t>(seconds / tickDt + 0.5);
+    return RewindBuffer(frames * BudgetBytesPerFrame, frames);
+}
+
+/**
+ * @brief Captures the current world and score as the newest frame.
+ *
+ * The previous newest frame is stored as a delta against the new one. If the world cannot be snapshotted
+ * (unsupported layout), the history is cleared instead.
+ *
+ * @param world World to snapshot (after its update for this tick).
+ * @param score Score to store with the frame.
+ */
+void RewindBuffer::record(const World& world, const Score& score) {
+    if (!world.saveState(current_.world)) {
+        clear();
+        return;
+    }
+    current_.score = score.value();
+
+    auto* current = reinterpret_cast<unsigned char*>(&current_);
+    auto* newest = reinterpret_cast<unsigned char*>(&newest_);
+
+    if (hasNewest_) {
+        const std::size_t size = encode(current, newest);
+
+        if (count_ == slots_.size()) {
+            evictOldest();
+        }
+        reserve(size);
+
+        std::memcpy(bytes_.data() + head_, scratch_.data(), size);
+        slot(count_) = Slot{static_cast<std::uint32_t>(head_), static_cast<std::uint32_t>(size)};
+        ++count_;
+
+        head_ += size;
+        usedBytes_ += size;
+    }
+
+    std::memcpy(newest, current, kFrameSize);
+    hasNewest_ = true;
+}
+
+/**
+ * @brief Moves back in time and restores the resulting frame into world and score.
+ * @param frames Number of frames to step back.
+ * @param world World to restore into (must have the same tile map loaded).
+ * @param score Score to restore into.
+ * @return Number of frames actually stepped back (0 if no history is available).
+ */
+std::size_t RewindBuffer::stepBack(std::size_t frames, World& world, Score& score) {
+    auto* newest = reinterpret_cast<unsigned char*>(&newest_);
+
+    std::size_t stepped = 0;
+    while (stepped < frames && count_ > 0) {
+        const Slot s = slot(count_ - 1);
+        decode(bytes_.data() + s.offset, s.size, newest);
+
+        --count_;
+        head_ = s.offset;
+        usedBytes_ -= s.size;
+        ++stepped;
+    }
+
+    if (stepped == 0) {
+        return 0;
+    }
+
+    if (!world.restoreState(newest_.world)) {
+        clear();
+        return 0;
+    }
+    score.setValue(static_cast<int>(newest_.score));
+    return stepped;
+}
+
+/**
+ * @brief Drops all stored history.
+ */
+void RewindBuffer::clear() noexcept {
+    first_ = 0;
+    count_ = 0;
+    head_ = 0;
+    usedBytes_ = 0;
+    hasNewest_ = false;
+}
+
+/**
+ * @brief XORs two frames and run-length encodes the zero bytes into the scratch buffer.
+ *
+ * The output is a sequence of tokens: a 16-bit count of zero bytes to skip, a 16-bit count of literal bytes,
+ * then the literal XOR bytes. Zero runs shorter than kMinZeroRun are kept inside literals so a token never
+ * costs more than the bytes it covers.
+ *
+ * @param a First frame bytes.
+ * @param b Second frame bytes.
+ * @return Encoded size in bytes.
+ */
+std::size_t RewindBuffer::encode(const unsigned char* a, const unsigned char* b) {
+    unsigned char* out = scratch_.data();
+    std::size_t written = 0;
+    std::size_t i = 0;
+
+    while (i < kFrameSize) {
+        std::size_t zeros = 0;
+        while (i + zeros < kFrameSize && zeros < kMaxRun && a[i + zeros] == b[i + zeros]) {
+            ++zeros;
+        }
+        i += zeros;
+        if (i == kFrameSize) {
+            break;
+        }
+
+        std::size_t j = i;
+        while (j < kFrameSize && j - i < kMaxRun) {
+            if (a[j] != b[j]) {
+                ++j;
+                continue;
+            }
+
+            std::size_t run = 0;
+            while (j + run < kFrameSize && run < kMinZeroRun && a[j + run] == b[j + run]) {
+                ++run;
+            }
+            if (run >= kMinZeroRun || j + run == kFrameSize) {
+                break;
+            }
+            j = std::min(j + run, i + kMaxRun);
+        }
+
+        putU16(out + written, zeros);
+        putU16(out + written + 2, j - i);
+        written += kTokenSize;
+
+        for (std::size_t k = i; k < j; ++k) {
+            out[written++] = static_cast<unsigned char>(a[k] ^ b[k]);
+        }
+        i = j;
+    }
+
+    return written;
+}
+
+/**
+ * @brief XORs an encoded delta into a frame in place.
+ * @param delta Encoded delta bytes.
+ * @param size Encoded size.
+ * @param frame Frame bytes to update.
+ */
+void RewindBuffer::decode(const unsigned char* delta, std::size_t size, unsigned char* frame) {
+    std::size_t pos = 0;
+    std::size_t read = 0;
+
+    while (read + kTokenSize <= size) {
+        pos += getU16(delta + read);
+        const std::size_t literals = getU16(delta + read + 2);
+        read += kTokenSize;
+
+        for (std::size_t k = 0; k < literals; ++k) {
+            frame[pos++] ^= delta[read++];
+        }
+    }
+}
+
+/**
+ * @brief Frees room for a delta of the given size at the write position, evicting the oldest deltas.
+ *
+ * Deltas are stored contiguously. If the delta does not fit before the end of the ring, everything stored
+ * behind the write position (which is older than the deltas at the front) is dropped and writing wraps to 0.
+ *
+ * @param size Encoded delta size.
+ */
+void RewindBuffer::reserve(std::size_t size) {
+    if (head_ + size > bytes_.size()) {
+        while (count_ > 0 && slot(0).offset >= head_) {
+            evictOldest();
+        }
+        head_ = 0;
+    }
+
+    while (count_ > 0 && slot(0).offset >= head_ && slot(0).offset < head_ + size) {
+        evictOldest();
+    }
+}
+
+/**
+ * @brief Discards the oldest stored delta.
+ */
+void RewindBuffer::evictOldest() noexcept {
+    usedBytes_ -= slot(0).size;
+    first_ = (first_ + 1) % slots_.size();
+    --count_;
+}
+
+} // namespace pacman::logic
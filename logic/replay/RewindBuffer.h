@@ -0,0 +1,153 @@
+#pragma once
+
+#include "../world/WorldState.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace pacman::logic {
+
+class Score;
+class World;
+
+/**
+ * @brief Full rewindable frame: world snapshot plus the score shown to the player.
+ */
+struct RewindFrame {
+    WorldState world{};
+    std::int64_t score{0};
+};
+
+static_assert(std::is_trivially_copyable_v<RewindFrame>, "RewindFrame is XOR-ed byte-wise");
+
+/**
+ * @brief Fixed-budget history of recent simulation frames for in-game rewind.
+ *
+ * Only the newest frame is kept in full. Every older frame is stored as the XOR of itself with its successor,
+ * compressed by run-length encoding the zero bytes, so consecutive frames that barely differ cost a few dozen
+ * bytes. Stepping back decodes the newest delta into the full frame and drops it, which makes it O(delta size).
+ *
+ * All storage is reserved in the constructor; record() and stepBack() never allocate. When the byte budget or
+ * the frame limit is reached, the oldest deltas are discarded.
+ */
+class RewindBuffer {
+public:
+    static constexpr double DefaultSeconds = 30.0;          ///< History kept by forTickRate() unless asked otherwise
+    static constexpr std::size_t BudgetBytesPerFrame = 584; ///< Byte budget per frame of history (~1 MiB for 1800)
+
+    /**
+     * @brief Reserves all storage up front.
+     * @param budgetBytes Total memory budget including the full frames and the index.
+     * @param maxFrames Maximum number of frames that can be stepped back over.
+     */
+    RewindBuffer(std::size_t budgetBytes, std::size_t maxFrames);
+
+    /**
+     * @brief Creates a buffer that holds a span of simulated time at the given tick length.
+     *
+     * The frame limit is the number of ticks in the span and the byte budget grows with it, so the history covers
+     * the same time at any tick rate.
+     *
+     * @param tickDt Simulation tick length in seconds.
+     * @param seconds Simulated time to keep.
+     * @return Buffer sized for the span.
+     */
+    static RewindBuffer forTickRate(double tickDt, double seconds = DefaultSeconds);
+
+    /**
+     * @brief Captures the current world and score as the newest frame.
+     * @param world World to snapshot (after its update for this tick).
+     * @param score Score to store with the frame.
+     */
+    void record(const World& world, const Score& score);
+
+    /**
+     * @brief Moves back in time and restores the resulting frame into world and score.
+     *
+     * Frames newer than the restored one are discarded, so recording continues from there.
+     *
+     * @param frames Number of frames to step back.
+     * @param world World to restore into (must have the same tile map loaded).
+     * @param score Score to restore into.
+     * @return Number of frames actually stepped back (0 if no history is available).
+     */
+    std::size_t stepBack(std::size_t frames, World& world, Score& score);
+
+    /**
+     * @brief Drops all stored history.
+     */
+    void clear() noexcept;
+
+    /**
+     * @brief Returns how many frames can currently be stepped back.
+     * @return Number of stored deltas.
+     */
+    std::size_t available() const noexcept { return count_; }
+
+    /**
+     * @brief Returns the number of bytes used by stored deltas.
+     * @return Used delta bytes.
+     */
+    std::size_t usedBytes() const noexcept { return usedBytes_; }
+
+private:
+    /**
+     * @brief Location of one encoded delta inside the byte ring.
+     */
+    struct Slot {
+        std::uint32_t offset{0};
+        std::uint32_t size{0};
+    };
+
+    /**
+     * @brief XORs two frames and run-length encodes the zero bytes into the scratch buffer.
+     * @param a First frame bytes.
+     * @param b Second frame bytes.
+     * @return Encoded size in bytes.
+     */
+    std::size_t encode(const unsigned char* a, const unsigned char* b);
+
+    /**
+     * @brief XORs an encoded delta into a frame in place.
+     * @param delta Encoded delta bytes.
+     * @param size Encoded size.
+     * @param frame Frame bytes to update.
+     */
+    static void decode(const unsigned char* delta, std::size_t size, unsigned char* frame);
+
+    /**
+     * @brief Frees room for a delta of the given size at the write position, evicting the oldest deltas.
+     * @param size Encoded delta size.
+     */
+    void reserve(std::size_t size);
+
+    /**
+     * @brief Discards the oldest stored delta.
+     */
+    void evictOldest() noexcept;
+
+    /**
+     * @brief Returns the slot of the i-th oldest delta.
+     * @param i Age index (0 = oldest).
+     * @return Slot reference.
+     */
+    Slot& slot(std::size_t i) noexcept { return slots_[(first_ + i) % slots_.size()]; }
+
+private:
+    std::vector<unsigned char> bytes_;   ///< Ring of encoded deltas
+    std::vector<unsigned char> scratch_; ///< Encoder output for one delta
+    std::vector<Slot> slots_;            ///< Ring of delta locations, oldest first
+
+    std::size_t first_{0};
+    std::size_t count_{0};
+    std::size_t head_{0}; ///< Byte offset where the next delta is written
+    std::size_t usedBytes_{0};
+
+    RewindFrame newest_{};
+    RewindFrame current_{};
+    bool hasNewest_{false};
+};
+
+} // namespace pacman::logic
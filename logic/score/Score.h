@@ -34,6 +34,12 @@ public:
      */
     void add(int amount) { currentScore_ += amount; }
 
+    /**
+     * @brief Overwrites the current score value (used when rewinding), keeping combo and decay timing.
+     * @param value New score.
+     */
+    void setValue(int value) noexcept { currentScore_ = value; }
+
     /**
      * @brief Returns the current score value.
      * @return Current score.
@@ -0,0 +1,255 @@
+#include "AllocationCounter.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <new>
+#include <sstream>
+
+namespace pacman::logic {
+
+namespace {
+/// Running totals of the current thread; constant-initialized so the hooks can use it before main.
+thread_local AllocationStats tStats{};
+} // namespace
+
+/**
+ * @brief Returns the singleton AllocationCounter instance.
+ * @return Reference to the global counter.
+ */
+AllocationCounter& AllocationCounter::getInstance() {
+    static AllocationCounter instance;
+    return instance;
+}
+
+/**
+ * @brief Returns the running totals of the calling thread.
+ * @return Allocations since the thread started (zero without hooks).
+ */
+AllocationStats AllocationCounter::threadStats() noexcept { return tStats; }
+
+/**
+ * @brief Adds one execution of a scope. Does not allocate, so it is safe inside other scopes.
+ * @param scope Scope name.
+ * @param delta Allocations made during the execution.
+ */
+void AllocationCounter::record(const char* scope, const AllocationStats& delta) noexcept {
+    std::scoped_lock lock(mtx_);
+
+    ScopeTotals* totals = slot(scope);
+    if (!totals) {
+        return;
+    }
+
+    ++totals->calls;
+    if (delta.allocations > 0) {
+        ++totals->allocatingCalls;
+    }
+    if (delta.allocations > totals->worst) {
+        totals->worst = delta.allocations;
+    }
+    totals->total.allocations += delta.allocations;
+    totals->total.bytes += delta.bytes;
+    totals->total.frees += delta.frees;
+}
+
+/**
+ * @brief Returns the totals recorded for a scope name.
+ * @param scope Scope name.
+ * @return Totals, all zero if the scope never ran.
+ */
+AllocationCounter::ScopeTotals AllocationCounter::totals(const char* scope) const noexcept {
+    std::scoped_lock lock(mtx_);
+
+    for (std::size_t i = 0; i < scopeCount_; ++i) {
+        if (std::strcmp(scopes_[i].name, scope) == 0) {
+            return scopes_[i];
+        }
+    }
+    return ScopeTotals{scope};
+}
+
+/**
+ * @brief Formats all scopes as a table, in order of first use.
+ * @return Multi-line report (empty if no scope ran).
+ */
+std::string AllocationCounter::report() const {
+    std::array<ScopeTotals, MaxScopes> scopes;
+    std::size_t count = 0;
+    {
+        std::scoped_lock lock(mtx_);
+        scopes = scopes_;
+        count = scopeCount_;
+    }
+
+    std::ostringstream out;
+    if (count == 0) {
+        return out.str();
+    }
+
+    out << std::left << std::setw(24) << "allocations" << std::right << std::setw(10) << "calls" << std::setw(12)
+        << "allocating" << std::setw(10) << "per call" << std::setw(8) << "worst" << std::setw(12) << "bytes" << '\n';
+    out << std::fixed << std::setprecision(2);
+    for (std::size_t i = 0; i < count; ++i) {
+        const ScopeTotals& s = scopes[i];
+        const double perCall = s.calls ? static_cast<double>(s.total.allocations) / static_cast<double>(s.calls) : 0.0;
+        out << std::left << std::setw(24) << s.name << std::right << std::setw(10) << s.calls << std::setw(12)
+            << s.allocatingCalls << std::setw(10) << perCall << std::setw(8) << s.worst << std::setw(12)
+            << s.total.bytes << '\n';
+    }
+
+    return out.str();
+}
+
+/**
+ * @brief Forgets all recorded scopes.
+ */
+void AllocationCounter::reset() noexcept {
+    std::scoped_lock lock(mtx_);
+
+    scopes_.fill(ScopeTotals{});
+    scopeCount_ = 0;
+}
+
+/**
+ * @brief Finds or adds the slot of a scope name; names are compared by content so equal literals from different
+ * translation units share a slot.
+ * @param scope Scope name.
+ * @return Slot, or nullptr when the table is full.
+ */
+AllocationCounter::ScopeTotals* AllocationCounter::slot(const char* scope) noexcept {
+    for (std::size_t i = 0; i < scopeCount_; ++i) {
+        if (scopes_[i].name == scope || std::strcmp(scopes_[i].name, scope) == 0) {
+            return &scopes_[i];
+        }
+    }
+
+    if (scopeCount_ == MaxScopes) {
+        return nullptr;
+    }
+
+    ScopeTotals& added = scopes_[scopeCount_++];
+    added.name = scope;
+    return &added;
+}
+
+} // namespace pacman::logic
+
+#if defined(PACMAN_ALLOC_TRACKING)
+// Replacement global allocation functions. Every form of operator new funnels into allocate(), every form of
+// operator delete into release(); both count into the calling thread's totals and use malloc/free underneath.
+namespace {
+
+/**
+ * @brief Counts and performs an allocation, calling the new-handler until it succeeds or there is none.
+ * @param size Requested size.
+ * @param alignment Requested alignment, 0 for the default.
+ * @return Allocated block, or nullptr if no new-handler is installed.
+ */
+void* allocate(std::size_t size, std::size_t alignment) noexcept {
+    auto& stats = pacman::logic::tStats;
+    ++stats.allocations;
+    stats.bytes += size;
+
+    if (size == 0) {
+        size = 1;
+    }
+
+    for (;;) {
+        void* block = nullptr;
+        if (alignment == 0) {
+            block = std::malloc(size);
+        } else {
+#if defined(_WIN32)
+            block = _aligned_malloc(size, alignment);
+#else
+            block = std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+#endif
+        }
+
+        if (block) {
+            return block;
+        }
+
+        const std::new_handler handler = std::get_new_handler();
+        if (!handler) {
+            return nullptr;
+        }
+        try {
+            handler();
+        } catch (...) {
+            return nullptr;
+        }
+    }
+}
+
+/**
+ * @brief Counts and performs a release.
+ * @param block Block from allocate(), may be null.
+ * @param aligned Whether the block came from an aligned operator new.
+ */
+void release(void* block, bool aligned) noexcept {
+    if (!block) {
+        return;
+    }
+
+    ++pacman::logic::tStats.frees;
+#if defined(_WIN32)
+    if (aligned) {
+        _aligned_free(block);
+        return;
+    }
+#else
+    static_cast<void>(aligned);
+#endif
+    std::free(block);
+}
+
+/**
+ * @brief Throwing allocation used by the plain operator new forms.
+ * @param size Requested size.
+ * @param alignment Requested alignment, 0 for the default.
+ * @return Allocated block.
+ */
+void* allocateOrThrow(std::size_t size, std::size_t alignment) {
+    void* block = allocate(size, alignment);
+    if (!block) {
+        throw std::bad_alloc();
+    }
+    return block;
+}
+
+} // namespace
+
+void* operator new(std::size_t size) { return allocateOrThrow(size, 0); }
+void* operator new[](std::size_t size) { return allocateOrThrow(size, 0); }
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept { return allocate(size, 0); }
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept { return allocate(size, 0); }
+
+void* operator new(std::size_t size, std::align_val_t al) {
+    return allocateOrThrow(size, static_cast<std::size_t>(al));
+}
+void* operator new[](std::size_t size, std::align_val_t al) {
+    return allocateOrThrow(size, static_cast<std::size_t>(al));
+}
+void* operator new(std::size_t size, std::align_val_t al, const std::nothrow_t&) noexcept {
+    return allocate(size, static_cast<std::size_t>(al));
+}
+void* operator new[](std::size_t size, std::align_val_t al, const std::nothrow_t&) noexcept {
+    return allocate(size, static_cast<std::size_t>(al));
+}
+
+void operator delete(void* block) noexcept { release(block, false); }
+void operator delete[](void* block) noexcept { release(block, false); }
+void operator delete(void* block, std::size_t) noexcept { release(block, false); }
+void operator delete[](void* block, std::size_t) noexcept { release(block, false); }
+void operator delete(void* block, const std::nothrow_t&) noexcept { release(block, false); }
+void operator delete[](void* block, const std::nothrow_t&) noexcept { release(block, false); }
+
+void operator delete(void* block, std::align_val_t) noexcept { release(block, true); }
+void operator delete[](void* block, std::align_val_t) noexcept { release(block, true); }
+void operator delete(void* block, std::size_t, std::align_val_t) noexcept { release(block, true); }
+void operator delete[](void* block, std::size_t, std::align_val_t) noexcept { release(block, true); }
+void operator delete(void* block, std::align_val_t, const std::nothrow_t&) noexcept { release(block, true); }
+void operator delete[](void* block, std::align_val_t, const std::nothrow_t&) noexcept { release(block, true); }
+#endif
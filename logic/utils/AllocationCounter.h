@@ -0,0 +1,159 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+namespace pacman::logic {
+
+/**
+ * @brief Heap activity counted by the global operator new/delete hooks.
+ */
+struct AllocationStats {
+    std::uint64_t allocations{0}; ///< Calls to operator new (all forms)
+    std::uint64_t bytes{0};       ///< Bytes requested from operator new
+    std::uint64_t frees{0};       ///< Calls to operator delete with a non-null pointer
+};
+
+/**
+ * @brief Singleton attributing heap allocations to named scopes.
+ *
+ * In builds with PACMAN_ALLOC_TRACKING the global operator new/delete are replaced by hooks that count into
+ * per-thread totals (plain thread-locals, no locks on the allocation path). An AllocationScope takes the difference
+ * of its thread's totals over its lifetime and records it here under its name, so nested scopes each see the
+ * allocations made inside them, including those of their children.
+ *
+ * Without PACMAN_ALLOC_TRACKING the hooks are not compiled, every count stays zero and the scope macro compiles to
+ * nothing. Budgets are enforced by the callers (logic_bench, Game) through AllocationScope::allocated().
+ */
+class AllocationCounter {
+public:
+    static constexpr std::size_t MaxScopes = 32; ///< Distinct scope names kept; further names are dropped
+
+    /**
+     * @brief Accumulated statistics of one scope name.
+     */
+    struct ScopeTotals {
+        const char* name{nullptr};
+        std::uint64_t calls{0};           ///< Scope executions
+        std::uint64_t allocatingCalls{0}; ///< Executions that allocated at all
+        std::uint64_t worst{0};           ///< Most allocations of a single execution
+        AllocationStats total{};
+    };
+
+    /**
+     * @brief Returns the singleton AllocationCounter instance.
+     * @return Reference to the global counter.
+     */
+    static AllocationCounter& getInstance();
+
+    /**
+     * @brief Returns whether the operator new/delete hooks are compiled in.
+     * @return True in builds with PACMAN_ALLOC_TRACKING.
+     */
+    static constexpr bool enabled() noexcept {
+#if defined(PACMAN_ALLOC_TRACKING)
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    /**
+     * @brief Returns the running totals of the calling thread.
+     * @return Allocations since the thread started (zero without hooks).
+     */
+    static AllocationStats threadStats() noexcept;
+
+    /**
+     * @brief Adds one execution of a scope.
+     * @param scope Scope name; must outlive the counter (string literal).
+     * @param delta Allocations made during the execution.
+     */
+    void record(const char* scope, const AllocationStats& delta) noexcept;
+
+    /**
+     * @brief Returns the totals recorded for a scope name.
+     * @param scope Scope name.
+     * @return Totals, all zero if the scope never ran.
+     */
+    ScopeTotals totals(const char* scope) const noexcept;
+
+    /**
+     * @brief Formats all scopes as a table: calls, allocating calls, allocations per call, worst call and bytes.
+     * @return Multi-line report.
+     */
+    std::string report() const;
+
+    /**
+     * @brief Forgets all recorded scopes.
+     */
+    void reset() noexcept;
+
+private:
+    AllocationCounter() = default;
+    ~AllocationCounter() = default;
+
+    AllocationCounter(const AllocationCounter&) = delete;
+    AllocationCounter& operator=(const AllocationCounter&) = delete;
+
+    /**
+     * @brief Finds or adds the slot of a scope name; caller holds mtx_.
+     * @param scope Scope name.
+     * @return Slot, or nullptr when the table is full.
+     */
+    ScopeTotals* slot(const char* scope) noexcept;
+
+private:
+    mutable std::mutex mtx_;
+    std::array<ScopeTotals, MaxScopes> scopes_{};
+    std::size_t scopeCount_{0};
+};
+
+/**
+ * @brief Counts the allocations of the calling thread during its lifetime; use PACMAN_ALLOC_SCOPE.
+ */
+class AllocationScope {
+public:
+    /**
+     * @brief Starts counting.
+     * @param name Scope name; must outlive the counter (string literal).
+     */
+    explicit AllocationScope(const char* name) noexcept : name_(name), start_(AllocationCounter::threadStats()) {}
+
+    /**
+     * @brief Records the allocations made since construction under the scope name.
+     */
+    ~AllocationScope() { AllocationCounter::getInstance().record(name_, allocated()); }
+
+    /**
+     * @brief Returns the allocations made on this thread since construction.
+     * @return Difference of the thread totals.
+     */
+    AllocationStats allocated() const noexcept {
+        const AllocationStats now = AllocationCounter::threadStats();
+        return {now.allocations - start_.allocations, now.bytes - start_.bytes, now.frees - start_.frees};
+    }
+
+    AllocationScope(const AllocationScope&) = delete;
+    AllocationScope& operator=(const AllocationScope&) = delete;
+
+private:
+    const char* name_;
+    AllocationStats start_;
+};
+
+} // namespace pacman::logic
+
+#define PACMAN_ALLOC_CONCAT_INNER(a, b) a##b
+#define PACMAN_ALLOC_CONCAT(a, b) PACMAN_ALLOC_CONCAT_INNER(a, b)
+
+#if defined(PACMAN_ALLOC_TRACKING)
+/// Attributes the allocations of the rest of the enclosing scope to the given name.
+#define PACMAN_ALLOC_SCOPE(name)                                                                                   \
+    const ::pacman::logic::AllocationScope PACMAN_ALLOC_CONCAT(pacmanAllocScope, __LINE__) { name }
+#else
+#define PACMAN_ALLOC_SCOPE(name) static_cast<void>(0)
+#endif
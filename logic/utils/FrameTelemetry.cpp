@@ -0,0 +1,222 @@
+#include "FrameTelemetry.h"
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <system_error>
+#include <utility>
+
+namespace pacman::logic {
+
+namespace {
+/// Frame, update and draw time bounds in seconds; 16.7 ms and 33.3 ms mark the 60 Hz and 30 Hz frame budgets.
+constexpr double kSecondsBounds[] = {0.001, 0.002, 0.004, 0.008, 0.0125, 0.0167, 0.02,
+                                     0.025, 0.0333, 0.05,  0.1,   0.25,   1.0};
+/// Simulation step time bounds in seconds; a step normally takes well under a millisecond.
+constexpr double kStepSecondsBounds[] = {0.00005, 0.0001, 0.00025, 0.0005, 0.001, 0.002,
+                                         0.004,   0.008,  0.0167,  0.0333, 0.1};
+/// State updates per frame; 0 means the frame ran no update, more than 2 means the main loop caught up.
+constexpr double kStepBounds[] = {0, 1, 2, 3, 4, 6, 8, 16};
+
+/**
+ * @brief Appends printf-style formatted text.
+ * @param out Output text.
+ * @param format printf format.
+ * @param args Format arguments.
+ */
+template <typename... Args>
+void appendf(std::string& out, const char* format, Args... args) {
+    char line[160];
+    const int n = std::snprintf(line, sizeof(line), format, args...);
+    if (n > 0) {
+        out.append(line, static_cast<std::size_t>(n) < sizeof(line) ? static_cast<std::size_t>(n) : sizeof(line) - 1);
+    }
+}
+} // namespace
+
+/**
+ * @brief Adds an observation to the first bucket whose upper bound it does not exceed.
+ * @param value Observed value.
+ */
+void FrameTelemetry::Histogram::observe(double value) noexcept {
+    std::size_t bucket = 0;
+    while (bucket < boundCount && value > bounds[bucket]) {
+        ++bucket;
+    }
+
+    buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+    sum.store(sum.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Starts the writer thread.
+ * @param path Metrics file to (re)write.
+ * @param flushSeconds Time between writes.
+ */
+FrameTelemetry::FrameTelemetry(std::string path, double flushSeconds)
+    : path_(std::move(path)),
+      flushInterval_(std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+          std::chrono::duration<double>(flushSeconds > 0.0 ? flushSeconds : DefaultFlushSeconds))) {
+    static_assert(std::size(kSecondsBounds) <= MaxBounds && std::size(kStepBounds) <= MaxBounds &&
+                      std::size(kStepSecondsBounds) <= MaxBounds,
+                  "too many histogram buckets");
+
+    frameSeconds_.bounds = stateUpdateSeconds_.bounds = drawSeconds_.bounds = kSecondsBounds;
+    frameSeconds_.boundCount = stateUpdateSeconds_.boundCount = drawSeconds_.boundCount = std::size(kSecondsBounds);
+    stateUpdates_.bounds = kStepBounds;
+    stateUpdates_.boundCount = std::size(kStepBounds);
+    simStepSeconds_.bounds = kStepSecondsBounds;
+    simStepSeconds_.boundCount = std::size(kStepSecondsBounds);
+
+    thread_ = std::thread([this] { run(); });
+}
+
+/**
+ * @brief Stops the writer thread and writes the file a last time.
+ */
+FrameTelemetry::~FrameTelemetry() {
+    {
+        std::scoped_lock lock(mtx_);
+        stop_ = true;
+    }
+    cv_.notify_all();
+
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+}
+
+/**
+ * @brief Adds a frame to the histograms.
+ * @param frame Frame measurements.
+ */
+void FrameTelemetry::record(const Frame& frame) noexcept {
+    frameSeconds_.observe(frame.frameSeconds);
+    stateUpdateSeconds_.observe(frame.stateUpdateSeconds);
+    drawSeconds_.observe(frame.drawSeconds);
+    stateUpdates_.observe(static_cast<double>(frame.stateUpdates));
+
+    if (frame.overflow) {
+        overflows_.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+/**
+ * @brief Adds a simulation step to its metrics.
+ * @param step Step measurements.
+ */
+void FrameTelemetry::recordSimStep(const SimStep& step) noexcept {
+    simStepSeconds_.observe(step.seconds);
+
+    if (step.droppedTicks > 0) {
+        simDroppedTicks_.fetch_add(step.droppedTicks, std::memory_order_relaxed);
+    }
+}
+
+/**
+ * @brief Formats all metrics in the Prometheus text exposition format.
+ * @return Metrics text.
+ */
+std::string FrameTelemetry::format() const {
+    std::string out;
+    out.reserve(4096);
+
+    formatHistogram(out, "pacman_frame_seconds", "Wall time between presented frames, before clamping.",
+                    frameSeconds_);
+    formatHistogram(out, "pacman_state_update_seconds",
+                    "Main-thread time in fixed-step state updates per frame; a level simulates on its own thread.",
+                    stateUpdateSeconds_);
+    formatHistogram(out, "pacman_draw_seconds", "Time spent drawing per frame, presenting excluded.", drawSeconds_);
+    formatHistogram(out, "pacman_state_updates_per_frame", "Fixed-step state updates run per frame on the main thread.",
+                    stateUpdates_);
+
+    out += "# HELP pacman_frame_clamps_total Frames whose time exceeded maxFrameDt and was clamped.\n";
+    out += "# TYPE pacman_frame_clamps_total counter\n";
+    appendf(out, "pacman_frame_clamps_total %llu\n",
+            static_cast<unsigned long long>(overflows_.load(std::memory_order_relaxed)));
+
+    formatHistogram(out, "pacman_sim_step_seconds", "Time of one simulation step on the simulation thread.",
+                    simStepSeconds_);
+
+    out += "# HELP pacman_sim_dropped_ticks_total Simulation ticks dropped because the simulation thread fell too far "
+           "behind.\n";
+    out += "# TYPE pacman_sim_dropped_ticks_total counter\n";
+    appendf(out, "pacman_sim_dropped_ticks_total %llu\n",
+            static_cast<unsigned long long>(simDroppedTicks_.load(std::memory_order_relaxed)));
+
+    return out;
+}
+
+/**
+ * @brief Appends one histogram in Prometheus text format (cumulative buckets, sum and count; the count is taken
+ * from the buckets so the two always agree).
+ * @param out Output text.
+ * @param name Metric name.
+ * @param help Help text.
+ * @param histogram Histogram to format.
+ */
+void FrameTelemetry::formatHistogram(std::string& out, const char* name, const char* help,
+                                     const Histogram& histogram) {
+    appendf(out, "# HELP %s %s\n", name, help);
+    appendf(out, "# TYPE %s histogram\n", name);
+
+    std::uint64_t cumulative = 0;
+    for (std::size_t i = 0; i < histogram.boundCount; ++i) {
+        cumulative += histogram.buckets[i].load(std::memory_order_relaxed);
+        appendf(out, "%s_bucket{le=\"%g\"} %llu\n", name, histogram.bounds[i],
+                static_cast<unsigned long long>(cumulative));
+    }
+    cumulative += histogram.buckets[histogram.boundCount].load(std::memory_order_relaxed);
+    appendf(out, "%s_bucket{le=\"+Inf\"} %llu\n", name, static_cast<unsigned long long>(cumulative));
+
+    appendf(out, "%s_sum %.9g\n", name, histogram.sum.load(std::memory_order_relaxed));
+    appendf(out, "%s_count %llu\n", name, static_cast<unsigned long long>(cumulative));
+}
+
+/**
+ * @brief Writer thread body: writes the file every flush interval, and once more when stopped.
+ */
+void FrameTelemetry::run() {
+    std::unique_lock lock(mtx_);
+    for (;;) {
+        const bool stopping = cv_.wait_for(lock, flushInterval_, [this] { return stop_; });
+
+        lock.unlock();
+        if (!write()) {
+            writeFailures_.fetch_add(1, std::memory_order_relaxed);
+        }
+        lock.lock();
+
+        if (stopping) {
+            return;
+        }
+    }
+}
+
+/**
+ * @brief Writes the metrics to a temporary file and renames it over the metrics file, so readers never see a
+ * partially written file.
+ * @return True on success.
+ */
+bool FrameTelemetry::write() const {
+    const std::string text = format();
+    const std::string temporary = path_ + ".tmp";
+
+    {
+        std::ofstream out(temporary, std::ios::trunc | std::ios::binary);
+        if (!out) {
+            return false;
+        }
+        out << text;
+        if (!out) {
+            return false;
+        }
+    }
+
+    std::error_code ec;
+    std::filesystem::rename(temporary, path_, ec);
+    return !ec;
+}
+
+} // namespace pacman::logic
@@ -0,0 +1,158 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace pacman::logic {
+
+/**
+ * @brief Frame health histograms, written periodically to a metrics file by a background thread.
+ *
+ * The render thread calls record() once per frame and the simulation thread calls recordSimStep() once per step;
+ * each only updates relaxed atomics of its own metrics and never waits on the writer. The writer thread formats the
+ * histograms every flush interval in the Prometheus text format (so the file can be picked up by a node_exporter
+ * textfile collector or read by hand) and replaces the file atomically via a temporary file and a rename. The file
+ * is written once more when the telemetry is destroyed.
+ *
+ * Recorded per frame (main thread): frame time, time in fixed-step state updates, draw time, number of those state
+ * updates and whether the frame time hit the maxFrameDt clamp. While a level runs its simulation is stepped on its
+ * own thread, so the state updates only cover polling and transitions; the simulation itself is recorded per step:
+ * step time and ticks dropped by the simulation thread's catch-up limit. Bucket counts and totals are read one by
+ * one, so a file may be off by the frame or step being recorded.
+ */
+class FrameTelemetry {
+public:
+    static constexpr double DefaultFlushSeconds = 10.0; ///< Time between two writes of the metrics file
+
+    /**
+     * @brief Measurements of one presented frame.
+     */
+    struct Frame {
+        double frameSeconds{0.0};       ///< Wall time since the previous frame, before clamping
+        double stateUpdateSeconds{0.0}; ///< Time spent in fixed-step StateManager updates on the main thread
+        double drawSeconds{0.0};        ///< Time spent drawing (presenting excluded)
+        unsigned stateUpdates{0};       ///< Fixed-step StateManager updates run in the frame
+        bool overflow{false};           ///< Frame time exceeded the maxFrameDt clamp
+    };
+
+    /**
+     * @brief Measurements of one simulation step.
+     */
+    struct SimStep {
+        double seconds{0.0};           ///< Time the step took on the simulation thread
+        std::uint64_t droppedTicks{0}; ///< Ticks the simulation thread dropped since the previous step
+    };
+
+    /**
+     * @brief Starts the writer thread.
+     * @param path Metrics file to (re)write.
+     * @param flushSeconds Time between writes.
+     */
+    explicit FrameTelemetry(std::string path, double flushSeconds = DefaultFlushSeconds);
+
+    /**
+     * @brief Stops the writer thread and writes the file a last time.
+     */
+    ~FrameTelemetry();
+
+    FrameTelemetry(const FrameTelemetry&) = delete;
+    FrameTelemetry& operator=(const FrameTelemetry&) = delete;
+
+    /**
+     * @brief Adds a frame to the histograms; lock-free, meant for a single recording thread.
+     * @param frame Frame measurements.
+     */
+    void record(const Frame& frame) noexcept;
+
+    /**
+     * @brief Adds a simulation step to its metrics; lock-free, meant for a single simulation thread at a time.
+     * @param step Step measurements.
+     */
+    void recordSimStep(const SimStep& step) noexcept;
+
+    /**
+     * @brief Formats all metrics in the Prometheus text exposition format.
+     * @return Metrics text.
+     */
+    std::string format() const;
+
+    /**
+     * @brief Returns how many writes of the metrics file failed so far.
+     * @return Failure count.
+     */
+    std::uint64_t writeFailures() const noexcept { return writeFailures_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Returns the metrics file path.
+     * @return Path given at construction.
+     */
+    const std::string& path() const noexcept { return path_; }
+
+private:
+    static constexpr std::size_t MaxBounds = 16; ///< Upper bucket bounds per histogram, +Inf excluded
+
+    /**
+     * @brief Fixed-bucket histogram with a single writer.
+     */
+    struct Histogram {
+        const double* bounds{nullptr};
+        std::size_t boundCount{0};
+        std::array<std::atomic<std::uint64_t>, MaxBounds + 1> buckets{}; ///< Non-cumulative, last is +Inf
+        std::atomic<double> sum{0.0};
+
+        /**
+         * @brief Adds an observation.
+         * @param value Observed value.
+         */
+        void observe(double value) noexcept;
+    };
+
+    /**
+     * @brief Writer thread body: writes the file every flush interval until stopped.
+     */
+    void run();
+
+    /**
+     * @brief Writes the metrics to a temporary file and renames it over the metrics file.
+     * @return True on success.
+     */
+    bool write() const;
+
+    /**
+     * @brief Appends one histogram in Prometheus text format.
+     * @param out Output text.
+     * @param name Metric name.
+     * @param help Help text.
+     * @param histogram Histogram to format.
+     */
+    static void formatHistogram(std::string& out, const char* name, const char* help, const Histogram& histogram);
+
+private:
+    std::string path_;
+    std::chrono::steady_clock::duration flushInterval_;
+
+    Histogram frameSeconds_;
+    Histogram stateUpdateSeconds_;
+    Histogram drawSeconds_;
+    Histogram stateUpdates_;
+    std::atomic<std::uint64_t> overflows_{0};
+
+    Histogram simStepSeconds_;                      ///< Written by recordSimStep() only
+    std::atomic<std::uint64_t> simDroppedTicks_{0}; ///< Written by recordSimStep() only
+    std::atomic<std::uint64_t> writeFailures_{0};
+
+    std::mutex mtx_;
+    std::condition_variable cv_;
+    bool stop_{false};
+
+    std::thread thread_; ///< Declared last so it starts after all other members are initialized
+};
+
+} // namespace pacman::logic
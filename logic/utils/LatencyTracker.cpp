@@ -0,0 +1,210 @@
+#include "LatencyTracker.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <sstream>
+
+namespace pacman::logic {
+
+namespace {
+constexpr const char* kStageNames[] = {"key -> applied", "key -> turned", "key -> displayed"};
+
+/**
+ * @brief Returns the bit used for a stage in Pending::reached.
+ * @param stage Stage.
+ * @return Bit mask.
+ */
+constexpr std::uint8_t stageBit(LatencyStage stage) { return static_cast<std::uint8_t>(1u << static_cast<int>(stage)); }
+} // namespace
+
+/**
+ * @brief Returns the singleton LatencyTracker instance.
+ * @return Reference to the global tracker.
+ */
+LatencyTracker& LatencyTracker::getInstance() {
+    static LatencyTracker instance;
+    return instance;
+}
+
+/**
+ * @brief Returns the current steady clock time, the time base of all stamps.
+ * @return Nanoseconds since the steady clock's epoch.
+ */
+std::int64_t LatencyTracker::nowNs() noexcept {
+    const auto now = std::chrono::steady_clock::now().time_since_epoch();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(now).count();
+}
+
+/**
+ * @brief Registers a key press, overwriting the oldest press still in flight if all slots are taken.
+ * @param timeNs Time the press was polled.
+ * @return Id to report the following stages with (never 0).
+ */
+std::uint32_t LatencyTracker::pressed(std::int64_t timeNs) {
+    std::scoped_lock lock(mtx_);
+
+    const std::uint32_t id = nextId_++;
+    if (nextId_ == 0) {
+        nextId_ = 1;
+    }
+
+    Pending& slot = pending_[id % PendingSlots];
+    if (slot.drawn) {
+        --drawnCount_;
+    }
+    slot = Pending{id, timeNs, 0, false};
+    return id;
+}
+
+/**
+ * @brief Records that the press reached the given stage now; repeated reports of a stage are ignored.
+ * @param id Id returned by pressed().
+ * @param stage Stage reached.
+ */
+void LatencyTracker::reached(std::uint32_t id, LatencyStage stage) {
+    if (id == 0) {
+        return;
+    }
+
+    const std::int64_t now = nowNs();
+    std::scoped_lock lock(mtx_);
+
+    Pending& slot = pending_[id % PendingSlots];
+    if (slot.id != id || (slot.reached & stageBit(stage)) != 0) {
+        return;
+    }
+
+    slot.reached |= stageBit(stage);
+    addSample(stage, now - slot.pressNs);
+}
+
+/**
+ * @brief Marks the press as visible in the frame being drawn.
+ * @param id Id returned by pressed().
+ */
+void LatencyTracker::drawn(std::uint32_t id) {
+    if (id == 0) {
+        return;
+    }
+
+    std::scoped_lock lock(mtx_);
+
+    Pending& slot = pending_[id % PendingSlots];
+    if (slot.id != id || slot.drawn) {
+        return;
+    }
+
+    slot.drawn = true;
+    ++drawnCount_;
+}
+
+/**
+ * @brief Records that the frame being drawn was presented and retires the presses it showed.
+ */
+void LatencyTracker::displayed() {
+    const std::int64_t now = nowNs();
+    std::scoped_lock lock(mtx_);
+
+    if (drawnCount_ == 0) {
+        return;
+    }
+
+    for (auto& slot : pending_) {
+        if (slot.drawn) {
+            addSample(LatencyStage::Displayed, now - slot.pressNs);
+            slot = Pending{};
+        }
+    }
+    drawnCount_ = 0;
+}
+
+/**
+ * @brief Appends a latency to a stage's sample ring, overwriting the oldest sample once full.
+ * @param stage Stage the sample belongs to.
+ * @param latencyNs Time since the press in nanoseconds.
+ */
+void LatencyTracker::addSample(LatencyStage stage, std::int64_t latencyNs) {
+    const auto index = static_cast<std::size_t>(stage);
+    auto& samples = samples_[index];
+
+    if (samples.size() < MaxSamples) {
+        samples.push_back(latencyNs);
+        return;
+    }
+
+    samples[nextSample_[index]] = latencyNs;
+    nextSample_[index] = (nextSample_[index] + 1) % MaxSamples;
+}
+
+/**
+ * @brief Computes nearest-rank percentiles of the recorded latencies of a stage.
+ * @param stage Stage to evaluate.
+ * @return Sample count and p50/p95/p99 in milliseconds.
+ */
+LatencyTracker::Percentiles LatencyTracker::percentiles(LatencyStage stage) const {
+    std::vector<std::int64_t> sorted;
+    {
+        std::scoped_lock lock(mtx_);
+        sorted = samples_[static_cast<std::size_t>(stage)];
+    }
+
+    Percentiles result{};
+    result.count = sorted.size();
+    if (sorted.empty()) {
+        return result;
+    }
+
+    std::sort(sorted.begin(), sorted.end());
+    const auto rank = [&sorted](double p) {
+        const auto index = static_cast<std::size_t>(p * static_cast<double>(sorted.size() - 1) + 0.5);
+        return static_cast<double>(sorted[index]) * 1e-6;
+    };
+
+    result.p50 = rank(0.50);
+    result.p95 = rank(0.95);
+    result.p99 = rank(0.99);
+    return result;
+}
+
+/**
+ * @brief Formats the percentiles of all stages as a small table.
+ * @return Multi-line report, or an empty string if nothing was recorded.
+ */
+std::string LatencyTracker::report() const {
+    std::ostringstream out;
+    out << std::fixed << std::setprecision(2);
+
+    bool any = false;
+    for (std::size_t i = 0; i < StageCount; ++i) {
+        const Percentiles p = percentiles(static_cast<LatencyStage>(i));
+        if (p.count == 0) {
+            continue;
+        }
+
+        if (!any) {
+            out << "input latency (ms)        n      p50      p95      p99\n";
+            any = true;
+        }
+        out << std::left << std::setw(18) << kStageNames[i] << std::right << std::setw(9) << p.count
+            << std::setw(9) << p.p50 << std::setw(9) << p.p95 << std::setw(9) << p.p99 << '\n';
+    }
+
+    return out.str();
+}
+
+/**
+ * @brief Discards all pending presses and recorded samples.
+ */
+void LatencyTracker::reset() {
+    std::scoped_lock lock(mtx_);
+
+    pending_.fill(Pending{});
+    drawnCount_ = 0;
+    for (auto& samples : samples_) {
+        samples.clear();
+    }
+    nextSample_.fill(0);
+}
+
+} // namespace pacman::logic
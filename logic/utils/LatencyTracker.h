@@ -0,0 +1,134 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace pacman::logic {
+
+/**
+ * @brief Stages an input passes through after its key press was polled.
+ */
+enum class LatencyStage : std::uint8_t {
+    Applied = 0,  ///< The simulation handed the direction to World::setPacManDirection()
+    Turned = 1,   ///< Pac-Man's heading changed to the requested direction
+    Displayed = 2 ///< The first frame showing the turn was presented
+};
+
+/**
+ * @brief Singleton that measures input-to-photon latency of direction key presses.
+ *
+ * Every press gets an id when it is polled; the simulation and render code report the id as it reaches each
+ * LatencyStage. Latencies are kept per stage (relative to the press) for the most recent presses and reported as
+ * percentiles. Presses that never reach a stage (e.g. superseded before Pac-Man could turn) are not counted for
+ * it. All methods are thread-safe; they are called a few times per key press, so a mutex is sufficient.
+ */
+class LatencyTracker {
+public:
+    /**
+     * @brief Percentiles of one stage in milliseconds.
+     */
+    struct Percentiles {
+        std::size_t count{0};
+        double p50{0.0};
+        double p95{0.0};
+        double p99{0.0};
+    };
+
+    /**
+     * @brief Returns the singleton LatencyTracker instance.
+     * @return Reference to the global tracker.
+     */
+    static LatencyTracker& getInstance();
+
+    /**
+     * @brief Returns the current steady clock time, the time base of all stamps.
+     * @return Nanoseconds since the steady clock's epoch.
+     */
+    static std::int64_t nowNs() noexcept;
+
+    /**
+     * @brief Registers a key press.
+     * @param timeNs Time the press was polled (see nowNs()).
+     * @return Id to report the following stages with (never 0).
+     */
+    std::uint32_t pressed(std::int64_t timeNs);
+
+    /**
+     * @brief Records that the press reached the given stage now.
+     * @param id Id returned by pressed(); 0 and unknown ids are ignored.
+     * @param stage Stage reached (Displayed is recorded through drawn()/displayed()).
+     */
+    void reached(std::uint32_t id, LatencyStage stage);
+
+    /**
+     * @brief Marks the press as visible in the frame being drawn; completed by the next displayed().
+     * @param id Id returned by pressed(); 0 and unknown ids are ignored.
+     */
+    void drawn(std::uint32_t id);
+
+    /**
+     * @brief Records that the frame being drawn was presented, completing all presses marked by drawn().
+     */
+    void displayed();
+
+    /**
+     * @brief Computes percentiles of the recorded latencies of a stage.
+     * @param stage Stage to evaluate.
+     * @return Sample count and p50/p95/p99 in milliseconds.
+     */
+    Percentiles percentiles(LatencyStage stage) const;
+
+    /**
+     * @brief Formats the percentiles of all stages as a small table.
+     * @return Multi-line report, or an empty string if nothing was recorded.
+     */
+    std::string report() const;
+
+    /**
+     * @brief Discards all pending presses and recorded samples.
+     */
+    void reset();
+
+private:
+    LatencyTracker() = default;
+    ~LatencyTracker() = default;
+
+    LatencyTracker(const LatencyTracker&) = delete;
+    LatencyTracker& operator=(const LatencyTracker&) = delete;
+
+    /**
+     * @brief Appends a latency to a stage's sample ring.
+     * @param stage Stage the sample belongs to.
+     * @param latencyNs Time since the press in nanoseconds.
+     */
+    void addSample(LatencyStage stage, std::int64_t latencyNs);
+
+private:
+    static constexpr std::size_t StageCount = 3;
+    static constexpr std::size_t PendingSlots = 64; ///< Presses in flight; older ones are overwritten
+    static constexpr std::size_t MaxSamples = 4096; ///< Samples kept per stage
+
+    /**
+     * @brief Press that has not been displayed yet.
+     */
+    struct Pending {
+        std::uint32_t id{0};
+        std::int64_t pressNs{0};
+        std::uint8_t reached{0}; ///< Bit per LatencyStage
+        bool drawn{false};
+    };
+
+    mutable std::mutex mtx_;
+    std::uint32_t nextId_{1};
+    std::array<Pending, PendingSlots> pending_{};
+    std::size_t drawnCount_{0}; ///< Pending presses waiting for displayed()
+
+    std::array<std::vector<std::int64_t>, StageCount> samples_{}; ///< Ring per stage, in nanoseconds
+    std::array<std::size_t, StageCount> nextSample_{};
+};
+
+} // namespace pacman::logic
@@ -0,0 +1,71 @@
+#include "MappedFile.h"
+
+#include <fstream>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define PACMAN_HAS_MMAP 1
+#endif
+
+namespace pacman::logic {
+
+/**
+ * @brief Opens and maps the given file, falling back to reading it into memory without mmap.
+ * @param path Path to the file.
+ */
+MappedFile::MappedFile(const std::string& path) {
+#ifdef PACMAN_HAS_MMAP
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return;
+    }
+
+    struct stat st{};
+    if (::fstat(fd, &st) == 0 && st.st_size > 0) {
+        void* addr = ::mmap(nullptr, static_cast<std::size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        if (addr != MAP_FAILED) {
+            data_ = static_cast<const std::byte*>(addr);
+            size_ = static_cast<std::size_t>(st.st_size);
+            mapped_ = true;
+        }
+    }
+
+    ::close(fd);
+#else
+    std::ifstream in(path, std::ios::binary | std::ios::ate);
+    if (!in) {
+        return;
+    }
+
+    const auto end = in.tellg();
+    if (end <= 0) {
+        return;
+    }
+
+    buffer_.resize(static_cast<std::size_t>(end));
+    in.seekg(0);
+    if (!in.read(reinterpret_cast<char*>(buffer_.data()), static_cast<std::streamsize>(buffer_.size()))) {
+        buffer_.clear();
+        return;
+    }
+
+    data_ = buffer_.data();
+    size_ = buffer_.size();
+#endif
+}
+
+/**
+ * @brief Unmaps the file (or releases the fallback buffer).
+ */
+MappedFile::~MappedFile() {
+#ifdef PACMAN_HAS_MMAP
+    if (mapped_) {
+        ::munmap(const_cast<std::byte*>(data_), size_);
+    }
+#endif
+}
+
+} // namespace pacman::logic
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace pacman::logic {
+
+/**
+ * @brief Read-only view of a whole file, memory-mapped where the platform supports it.
+ *
+ * On POSIX systems the file is mapped with mmap so pages are only loaded when touched.
+ * Elsewhere the file is read into an owned buffer, keeping the same interface.
+ */
+class MappedFile {
+public:
+    /**
+     * @brief Opens and maps the given file.
+     * @param path Path to the file.
+     */
+    explicit MappedFile(const std::string& path);
+
+    /**
+     * @brief Unmaps the file.
+     */
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /**
+     * @brief Returns whether the file was opened successfully.
+     * @return True if data() is valid.
+     */
+    bool isOpen() const noexcept { return data_ != nullptr; }
+
+    /**
+     * @brief Returns a pointer to the first byte of the file.
+     * @return File contents, or nullptr if the file could not be opened.
+     */
+    const std::byte* data() const noexcept { return data_; }
+
+    /**
+     * @brief Returns the file size in bytes.
+     * @return File size.
+     */
+    std::size_t size() const noexcept { return size_; }
+
+private:
+    const std::byte* data_{nullptr};
+    std::size_t size_{0};
+    bool mapped_{false};
+    std::vector<std::byte> buffer_;
+};
+
+} // namespace pacman::logic
@@ -0,0 +1,216 @@
+#include "PerfCounters.h"
+
+#include <cerrno>
+#include <cstring>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#define PACMAN_HAS_PERF_EVENTS 1
+#endif
+
+namespace pacman::logic {
+
+namespace {
+constexpr const char* kCounterNames[PerfCounterCount] = {"cycles", "instructions", "L1d-misses", "LLC-misses",
+                                                         "branch-misses"};
+
+thread_local PerfCounters* tCollector = nullptr;
+
+#ifdef PACMAN_HAS_PERF_EVENTS
+/**
+ * @brief Returns the perf event type and config of a counter.
+ * @param counter Counter.
+ * @param attr Receives the event type and config.
+ */
+void eventOf(PerfCounter counter, perf_event_attr& attr) {
+    switch (counter) {
+    case PerfCounter::Cycles:
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = PERF_COUNT_HW_CPU_CYCLES;
+        break;
+    case PerfCounter::Instructions:
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+        break;
+    case PerfCounter::L1DMisses:
+        attr.type = PERF_TYPE_HW_CACHE;
+        attr.config = PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                      (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+        break;
+    case PerfCounter::LlcMisses:
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = PERF_COUNT_HW_CACHE_MISSES;
+        break;
+    case PerfCounter::BranchMisses:
+    case PerfCounter::Count:
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = PERF_COUNT_HW_BRANCH_MISSES;
+        break;
+    }
+}
+
+/**
+ * @brief Opens one counter of the calling thread (user space only).
+ * @param counter Counter to open.
+ * @param groupFd Group leader, or -1 to open the leader itself.
+ * @return File descriptor, or -1 (errno set).
+ */
+int openCounter(PerfCounter counter, int groupFd) {
+    perf_event_attr attr{};
+    attr.size = sizeof(attr);
+    eventOf(counter, attr);
+    attr.disabled = groupFd < 0 ? 1 : 0;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+    return static_cast<int>(::syscall(SYS_perf_event_open, &attr, 0, -1, groupFd, 0));
+}
+#endif
+} // namespace
+
+/**
+ * @brief Opens the counters for the calling thread.
+ *
+ * The cycle counter leads the group; other counters that cannot be opened are skipped and listed in error().
+ */
+PerfCounters::PerfCounters() {
+    fds_.fill(-1);
+
+#ifdef PACMAN_HAS_PERF_EVENTS
+    for (std::size_t i = 0; i < PerfCounterCount; ++i) {
+        const auto counter = static_cast<PerfCounter>(i);
+        const int fd = openCounter(counter, fds_[0]);
+        if (fd < 0) {
+            const int err = errno;
+            if (i == 0) {
+                error_ = std::string("perf_event_open not permitted or unsupported (") + std::strerror(err) +
+                         "); check /proc/sys/kernel/perf_event_paranoid";
+                return;
+            }
+            error_ += (error_.empty() ? "unavailable: " : ", ") + std::string(name(counter));
+            continue;
+        }
+
+        fds_[i] = fd;
+        groupIndex_[i] = openCount_++;
+    }
+
+    ::ioctl(fds_[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ::ioctl(fds_[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+#else
+    error_ = "hardware counters are only supported on Linux";
+#endif
+}
+
+/**
+ * @brief Detaches from the thread and closes the counters.
+ */
+PerfCounters::~PerfCounters() {
+    detachFromThread();
+
+#ifdef PACMAN_HAS_PERF_EVENTS
+    for (std::size_t i = PerfCounterCount; i-- > 0;) {
+        if (fds_[i] >= 0) {
+            ::close(fds_[i]);
+        }
+    }
+#endif
+}
+
+/**
+ * @brief Reads the current counter values, scaled by enabled/running time when the kernel multiplexed them.
+ * @param out Reading to fill.
+ * @return False if the counters are unavailable or the read failed.
+ */
+bool PerfCounters::read(Sample& out) const noexcept {
+    if (!available()) {
+        return false;
+    }
+
+#ifdef PACMAN_HAS_PERF_EVENTS
+    std::uint64_t buffer[3 + PerfCounterCount]{};
+    const auto bytes = ::read(fds_[0], buffer, sizeof(buffer));
+    if (bytes < static_cast<ssize_t>(3 * sizeof(std::uint64_t)) || buffer[0] != openCount_) {
+        return false;
+    }
+
+    const std::uint64_t enabled = buffer[1];
+    const std::uint64_t running = buffer[2];
+    const double scale = (running > 0 && running < enabled) ? static_cast<double>(enabled) / running : 1.0;
+
+    for (std::size_t i = 0; i < PerfCounterCount; ++i) {
+        const std::uint64_t raw = fds_[i] >= 0 ? buffer[3 + groupIndex_[i]] : 0;
+        out.values[i] = static_cast<std::uint64_t>(static_cast<double>(raw) * scale);
+    }
+    return true;
+#else
+    (void)out;
+    return false;
+#endif
+}
+
+/**
+ * @brief Adds the difference of two readings to a phase.
+ * @param phase Phase the code between the readings belongs to.
+ * @param begin Reading before the code.
+ * @param end Reading after the code.
+ */
+void PerfCounters::add(ProfilePhase phase, const Sample& begin, const Sample& end) noexcept {
+    const auto index = static_cast<std::size_t>(phase);
+    if (index >= ProfilePhaseCount) {
+        return;
+    }
+
+    for (std::size_t i = 0; i < PerfCounterCount; ++i) {
+        if (end.values[i] >= begin.values[i]) {
+            totals_[index].values[i] += end.values[i] - begin.values[i];
+        }
+    }
+    ++calls_[index];
+}
+
+/**
+ * @brief Clears all accumulated phase totals.
+ */
+void PerfCounters::resetTotals() noexcept {
+    totals_.fill(Sample{});
+    calls_.fill(0);
+}
+
+/**
+ * @brief Makes this collector receive the profile scopes of the calling thread.
+ */
+void PerfCounters::attachToThread() noexcept { tCollector = this; }
+
+/**
+ * @brief Stops receiving profile scopes if this collector is attached to the calling thread.
+ */
+void PerfCounters::detachFromThread() noexcept {
+    if (tCollector == this) {
+        tCollector = nullptr;
+    }
+}
+
+/**
+ * @brief Returns the collector attached to the calling thread.
+ * @return Collector, or nullptr if none is attached or it is unavailable.
+ */
+PerfCounters* PerfCounters::threadCollector() noexcept {
+    return (tCollector && tCollector->available()) ? tCollector : nullptr;
+}
+
+/**
+ * @brief Returns a short display name for a counter.
+ * @param counter Counter.
+ * @return Static name string.
+ */
+const char* PerfCounters::name(PerfCounter counter) noexcept {
+    const auto index = static_cast<std::size_t>(counter);
+    return index < PerfCounterCount ? kCounterNames[index] : "?";
+}
+
+} // namespace pacman::logic
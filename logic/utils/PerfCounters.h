@@ -0,0 +1,154 @@
+#pragma once
+
+#include "ProfilePhase.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace pacman::logic {
+
+/**
+ * @brief Hardware events collected by PerfCounters.
+ */
+enum class PerfCounter : std::uint8_t {
+    Cycles = 0,
+    Instructions,
+    L1DMisses,    ///< L1 data cache read misses
+    LlcMisses,    ///< Last-level cache misses
+    BranchMisses,
+    Count
+};
+
+inline constexpr std::size_t PerfCounterCount = static_cast<std::size_t>(PerfCounter::Count);
+
+/**
+ * @brief Optional hardware performance counters for the calling thread, grouped per ProfilePhase.
+ *
+ * On Linux the counters are opened as one perf_event_open group (user space only) so they are scheduled
+ * together; values are scaled when the kernel multiplexes them. Counters the CPU or the kernel does not allow are
+ * left out individually; if not even the cycle counter can be opened the collector reports itself unavailable and
+ * every call becomes a no-op, so callers never need a separate code path. Other platforms are always unavailable.
+ *
+ * Once attached to a thread, every PACMAN_PROFILE_SCOPE on that thread adds its counter deltas to its phase
+ * (requires a PACMAN_PROFILE build and an enabled Profiler). Counts can also be taken around any code with read().
+ */
+class PerfCounters {
+public:
+    /**
+     * @brief Counter values of one reading or one accumulated phase.
+     */
+    struct Sample {
+        std::array<std::uint64_t, PerfCounterCount> values{};
+
+        /**
+         * @brief Returns one counter value.
+         * @param counter Counter to read.
+         * @return Value (0 for counters that are not available).
+         */
+        std::uint64_t operator[](PerfCounter counter) const noexcept {
+            return values[static_cast<std::size_t>(counter)];
+        }
+    };
+
+    /**
+     * @brief Opens the counters for the calling thread; check available() afterwards.
+     */
+    PerfCounters();
+
+    /**
+     * @brief Detaches from the thread and closes the counters.
+     */
+    ~PerfCounters();
+
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+
+    /**
+     * @brief Returns whether at least the cycle counter could be opened.
+     * @return True if readings are meaningful.
+     */
+    bool available() const noexcept { return fds_[0] >= 0; }
+
+    /**
+     * @brief Returns whether a specific counter could be opened.
+     * @param counter Counter to query.
+     * @return True if the counter is counted.
+     */
+    bool has(PerfCounter counter) const noexcept { return fds_[static_cast<std::size_t>(counter)] >= 0; }
+
+    /**
+     * @brief Returns why the counters are unavailable or incomplete.
+     * @return Human-readable reason, empty if all counters are open.
+     */
+    const std::string& error() const noexcept { return error_; }
+
+    /**
+     * @brief Reads the current counter values (scaled for multiplexing).
+     * @param out Reading to fill.
+     * @return False if the counters are unavailable or the read failed.
+     */
+    bool read(Sample& out) const noexcept;
+
+    /**
+     * @brief Adds the difference of two readings to a phase.
+     * @param phase Phase the code between the readings belongs to.
+     * @param begin Reading before the code.
+     * @param end Reading after the code.
+     */
+    void add(ProfilePhase phase, const Sample& begin, const Sample& end) noexcept;
+
+    /**
+     * @brief Returns the accumulated counts of a phase.
+     * @param phase Phase to query.
+     * @return Sum of all deltas added for the phase.
+     */
+    const Sample& total(ProfilePhase phase) const noexcept { return totals_[static_cast<std::size_t>(phase)]; }
+
+    /**
+     * @brief Returns how many deltas were added for a phase.
+     * @param phase Phase to query.
+     * @return Number of measured scopes.
+     */
+    std::uint64_t calls(ProfilePhase phase) const noexcept { return calls_[static_cast<std::size_t>(phase)]; }
+
+    /**
+     * @brief Clears all accumulated phase totals.
+     */
+    void resetTotals() noexcept;
+
+    /**
+     * @brief Makes this collector receive the profile scopes of the calling thread.
+     */
+    void attachToThread() noexcept;
+
+    /**
+     * @brief Stops receiving profile scopes if this collector is attached to the calling thread.
+     */
+    void detachFromThread() noexcept;
+
+    /**
+     * @brief Returns the collector attached to the calling thread.
+     * @return Collector, or nullptr if none is attached or it is unavailable.
+     */
+    static PerfCounters* threadCollector() noexcept;
+
+    /**
+     * @brief Returns a short display name for a counter.
+     * @param counter Counter.
+     * @return Static name string.
+     */
+    static const char* name(PerfCounter counter) noexcept;
+
+private:
+    std::array<int, PerfCounterCount> fds_{};
+    std::array<std::size_t, PerfCounterCount> groupIndex_{}; ///< Position of each counter in a group read
+    std::size_t openCount_{0};
+    std::string error_;
+
+    std::array<Sample, ProfilePhaseCount> totals_{};
+    std::array<std::uint64_t, ProfilePhaseCount> calls_{};
+};
+
+} // namespace pacman::logic
@@ -0,0 +1,48 @@
+#include "ProcessMemory.h"
+
+#if defined(__linux__)
+#include <cstdio>
+#include <unistd.h>
+#define PACMAN_HAS_STATM 1
+#elif defined(__APPLE__)
+#include <mach/mach.h>
+#define PACMAN_HAS_TASK_INFO 1
+#endif
+
+namespace pacman::logic {
+
+/**
+ * @brief Returns the resident set size of the current process.
+ * @return Resident bytes, or std::nullopt if it cannot be read.
+ */
+std::optional<std::uint64_t> residentSetBytes() noexcept {
+#if defined(PACMAN_HAS_STATM)
+    std::FILE* file = std::fopen("/proc/self/statm", "r");
+    if (!file) {
+        return std::nullopt;
+    }
+
+    unsigned long long sizePages = 0;
+    unsigned long long residentPages = 0;
+    const int fields = std::fscanf(file, "%llu %llu", &sizePages, &residentPages);
+    std::fclose(file);
+
+    const long pageSize = ::sysconf(_SC_PAGESIZE);
+    if (fields != 2 || pageSize <= 0) {
+        return std::nullopt;
+    }
+    return residentPages * static_cast<std::uint64_t>(pageSize);
+#elif defined(PACMAN_HAS_TASK_INFO)
+    mach_task_basic_info_data_t info{};
+    mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+    if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO, reinterpret_cast<task_info_t>(&info), &count) !=
+        KERN_SUCCESS) {
+        return std::nullopt;
+    }
+    return static_cast<std::uint64_t>(info.resident_size);
+#else
+    return std::nullopt;
+#endif
+}
+
+} // namespace pacman::logic
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+
+namespace pacman::logic {
+
+/**
+ * @brief Returns the resident set size of the current process.
+ *
+ * Read from /proc/self/statm on Linux and from the task info on macOS; other platforms report nothing.
+ *
+ * @return Resident bytes, or std::nullopt if the platform offers no cheap way to read it.
+ */
+std::optional<std::uint64_t> residentSetBytes() noexcept;
+
+} // namespace pacman::logic
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace pacman::logic {
+
+/**
+ * @brief Measured phases: the eight steps of World::update(), the game loop's event polling, the simulation steps
+ * of a running level and drawing.
+ */
+enum class ProfilePhase : std::uint8_t {
+    Release = 0,       ///< World: ghost release queue
+    Turning,           ///< World: buffered Pac-Man turns
+    Entities,          ///< World: entity updates
+    Collisions,        ///< World: solid collision detection
+    ResolveCollisions, ///< World: solid collision resolution
+    Overlaps,          ///< World: soft overlap detection
+    ResolveOverlaps,   ///< World: pickups, fear and ghost hits
+    Fear,              ///< World: fear timer
+    Events,            ///< Game loop: event polling
+    Update,            ///< Simulation thread: LevelState steps, World phases included
+    Draw,              ///< Game loop: drawing (presenting excluded)
+    Count
+};
+
+inline constexpr std::size_t ProfilePhaseCount = static_cast<std::size_t>(ProfilePhase::Count);
+
+} // namespace pacman::logic
@@ -0,0 +1,118 @@
+#include "Profiler.h"
+
+#include <bit>
+
+namespace pacman::logic {
+
+namespace {
+constexpr const char* kPhaseNames[ProfilePhaseCount] = {"release", "turning", "entities", "collisions",
+                                                        "resolve", "overlaps", "collect", "fear",
+                                                        "events", "update", "draw"};
+} // namespace
+
+/**
+ * @brief Returns the singleton Profiler instance.
+ * @return Reference to the global profiler.
+ */
+Profiler& Profiler::getInstance() {
+    static Profiler instance;
+    return instance;
+}
+
+/**
+ * @brief Closes the current frame: moves its totals into the history ring and updates the rolling histograms.
+ *
+ * The frame leaving the window is subtracted from the histograms, so they always describe the last
+ * HistoryFrames frames.
+ */
+void Profiler::endFrame() noexcept {
+    auto& row = history_[nextFrame_];
+    const bool evicting = recordedFrames_ == HistoryFrames;
+
+    for (std::size_t i = 0; i < ProfilePhaseCount; ++i) {
+        if (evicting) {
+            --buckets_[i][bucketOf(row[i])];
+        }
+
+        row[i] = current_[i].exchange(0, std::memory_order_relaxed);
+        ++buckets_[i][bucketOf(row[i])];
+    }
+
+    nextFrame_ = (nextFrame_ + 1) % HistoryFrames;
+    if (!evicting) {
+        ++recordedFrames_;
+    }
+}
+
+/**
+ * @brief Returns the duration of a phase in a past frame.
+ * @param framesAgo 0 for the last closed frame.
+ * @param phase Phase to query.
+ * @return Duration in nanoseconds (0 for frames not recorded yet).
+ */
+std::int64_t Profiler::frameNs(std::size_t framesAgo, ProfilePhase phase) const noexcept {
+    if (framesAgo >= recordedFrames_) {
+        return 0;
+    }
+
+    const std::size_t index = (nextFrame_ + HistoryFrames - 1 - framesAgo) % HistoryFrames;
+    return history_[index][static_cast<std::size_t>(phase)];
+}
+
+/**
+ * @brief Returns the number of frames in the window whose phase time fell into a bucket.
+ * @param phase Phase to query.
+ * @param bucket Bucket index.
+ * @return Frame count (0 for out-of-range buckets).
+ */
+std::uint32_t Profiler::bucketCount(ProfilePhase phase, std::size_t bucket) const noexcept {
+    if (bucket >= BucketCount) {
+        return 0;
+    }
+    return buckets_[static_cast<std::size_t>(phase)][bucket];
+}
+
+/**
+ * @brief Estimates a percentile of a phase over the window from its histogram.
+ * @param phase Phase to query.
+ * @param p Percentile in [0, 1].
+ * @return Upper bound of the bucket containing the percentile, in microseconds (0 if nothing was recorded).
+ */
+double Profiler::percentileUs(ProfilePhase phase, double p) const noexcept {
+    if (recordedFrames_ == 0) {
+        return 0.0;
+    }
+
+    const auto target = static_cast<std::uint32_t>(p * static_cast<double>(recordedFrames_ - 1)) + 1;
+    std::uint32_t seen = 0;
+    for (std::size_t b = 0; b < BucketCount; ++b) {
+        seen += buckets_[static_cast<std::size_t>(phase)][b];
+        if (seen >= target) {
+            return static_cast<double>(std::uint64_t{1} << b);
+        }
+    }
+    return static_cast<double>(std::uint64_t{1} << (BucketCount - 1));
+}
+
+/**
+ * @brief Returns a short display name for a phase.
+ * @param phase Phase.
+ * @return Static name string.
+ */
+const char* Profiler::name(ProfilePhase phase) noexcept {
+    const auto index = static_cast<std::size_t>(phase);
+    return index < ProfilePhaseCount ? kPhaseNames[index] : "?";
+}
+
+/**
+ * @brief Maps a duration to its histogram bucket (power-of-two microseconds, last bucket open-ended).
+ * @param ns Duration in nanoseconds.
+ * @return Bucket index.
+ */
+std::size_t Profiler::bucketOf(std::int64_t ns) noexcept {
+    const auto us = static_cast<std::uint64_t>(ns > 0 ? ns / 1000 : 0);
+    const auto width = static_cast<std::size_t>(std::bit_width(us));
+    return width < BucketCount ? width : BucketCount - 1;
+}
+
+} // namespace pacman::logic
@@ -0,0 +1,176 @@
+#pragma once
+
+#include "PerfCounters.h"
+#include "ProfilePhase.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace pacman::logic {
+
+/**
+ * @brief Singleton collecting per-phase timings into a rolling window of frames.
+ *
+ * Scoped timers add their duration to the current frame from any thread (relaxed atomics, no locks). endFrame(),
+ * called once per presented frame by the render thread, moves the totals into a ring of the last HistoryFrames
+ * frames and into a per-phase histogram of that window with power-of-two microsecond buckets. History and
+ * histograms must only be read on the thread calling endFrame().
+ *
+ * Recording is off until setEnabled(true); the scope macro compiles to nothing unless PACMAN_PROFILE is defined.
+ */
+class Profiler {
+public:
+    static constexpr std::size_t HistoryFrames = 120; ///< Frames kept for the overlay and the histograms
+    static constexpr std::size_t BucketCount = 16;    ///< Bucket i holds frames with 2^(i-1) <= us < 2^i
+
+    /**
+     * @brief Returns the singleton Profiler instance.
+     * @return Reference to the global profiler.
+     */
+    static Profiler& getInstance();
+
+    /**
+     * @brief Enables or disables recording; disabled scopes do not read the clock.
+     * @param enabled New state.
+     */
+    void setEnabled(bool enabled) noexcept { enabled_.store(enabled, std::memory_order_relaxed); }
+
+    /**
+     * @brief Returns whether recording is enabled.
+     * @return True if scoped timers record.
+     */
+    bool enabled() const noexcept { return enabled_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Adds a duration to a phase of the current frame.
+     * @param phase Phase measured.
+     * @param ns Duration in nanoseconds.
+     */
+    void record(ProfilePhase phase, std::int64_t ns) noexcept {
+        current_[static_cast<std::size_t>(phase)].fetch_add(ns, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Closes the current frame and moves its totals into the history.
+     */
+    void endFrame() noexcept;
+
+    /**
+     * @brief Returns the duration of a phase in a past frame.
+     * @param framesAgo 0 for the last closed frame, up to HistoryFrames - 1.
+     * @param phase Phase to query.
+     * @return Duration in nanoseconds (0 for frames not recorded yet).
+     */
+    std::int64_t frameNs(std::size_t framesAgo, ProfilePhase phase) const noexcept;
+
+    /**
+     * @brief Returns the number of frames in the window whose phase time fell into a bucket.
+     * @param phase Phase to query.
+     * @param bucket Bucket index below BucketCount.
+     * @return Frame count.
+     */
+    std::uint32_t bucketCount(ProfilePhase phase, std::size_t bucket) const noexcept;
+
+    /**
+     * @brief Estimates a percentile of a phase over the window from its histogram.
+     * @param phase Phase to query.
+     * @param p Percentile in [0, 1].
+     * @return Upper bound of the bucket containing the percentile, in microseconds.
+     */
+    double percentileUs(ProfilePhase phase, double p) const noexcept;
+
+    /**
+     * @brief Returns a short display name for a phase.
+     * @param phase Phase.
+     * @return Static name string.
+     */
+    static const char* name(ProfilePhase phase) noexcept;
+
+private:
+    Profiler() = default;
+    ~Profiler() = default;
+
+    Profiler(const Profiler&) = delete;
+    Profiler& operator=(const Profiler&) = delete;
+
+    /**
+     * @brief Maps a duration to its histogram bucket.
+     * @param ns Duration in nanoseconds.
+     * @return Bucket index.
+     */
+    static std::size_t bucketOf(std::int64_t ns) noexcept;
+
+private:
+    std::atomic<bool> enabled_{false};
+    std::array<std::atomic<std::int64_t>, ProfilePhaseCount> current_{};
+
+    std::array<std::array<std::int64_t, ProfilePhaseCount>, HistoryFrames> history_{};
+    std::array<std::array<std::uint32_t, BucketCount>, ProfilePhaseCount> buckets_{};
+    std::size_t nextFrame_{0};
+    std::size_t recordedFrames_{0};
+};
+
+/**
+ * @brief Adds the lifetime of the scope to a phase of the current frame; use PACMAN_PROFILE_SCOPE.
+ */
+class ProfileScope {
+public:
+    /**
+     * @brief Starts timing if the profiler is enabled.
+     * @param phase Phase to attribute the scope to.
+     */
+    explicit ProfileScope(ProfilePhase phase) noexcept : phase_(phase), active_(Profiler::getInstance().enabled()) {
+        if (active_) {
+            counters_ = PerfCounters::threadCollector();
+            if (counters_ && !counters_->read(startCounters_)) {
+                counters_ = nullptr;
+            }
+            start_ = Clock::now();
+        }
+    }
+
+    /**
+     * @brief Records the elapsed time, and the counter deltas if a PerfCounters collector is attached.
+     */
+    ~ProfileScope() {
+        if (!active_) {
+            return;
+        }
+
+        const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start_);
+        Profiler::getInstance().record(phase_, elapsed.count());
+
+        PerfCounters::Sample endCounters;
+        if (counters_ && counters_->read(endCounters)) {
+            counters_->add(phase_, startCounters_, endCounters);
+        }
+    }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    ProfilePhase phase_;
+    bool active_;
+    Clock::time_point start_{};
+    PerfCounters* counters_{nullptr};
+    PerfCounters::Sample startCounters_;
+};
+
+} // namespace pacman::logic
+
+#define PACMAN_PROFILE_CONCAT_INNER(a, b) a##b
+#define PACMAN_PROFILE_CONCAT(a, b) PACMAN_PROFILE_CONCAT_INNER(a, b)
+
+#if defined(PACMAN_PROFILE)
+/// Times the rest of the enclosing scope as the given ProfilePhase.
+#define PACMAN_PROFILE_SCOPE(phase)                                                                                \
+    const ::pacman::logic::ProfileScope PACMAN_PROFILE_CONCAT(pacmanProfileScope, __LINE__) { phase }
+#else
+#define PACMAN_PROFILE_SCOPE(phase) static_cast<void>(0)
+#endif
@@ -100,4 +100,16 @@ void Random::shuffleIndices(std::vector<std::size_t>& indices) {
     std::shuffle(indices.begin(), indices.end(), engine_);
 }
 
+/**
+ * @brief Returns a copy of the full engine state (used by world snapshots).
+ * @return Current engine state.
+ */
+std::mt19937 Random::engineState() const { return engine_; }
+
+/**
+ * @brief Replaces the engine state with a previously saved one.
+ * @param state Engine state returned by engineState().
+ */
+void Random::setEngineState(const std::mt19937& state) { engine_ = state; }
+
 } // namespace pacman::logic
\ No newline at end of file
@@ -75,6 +75,18 @@ public:
      */
     void shuffleIndices(std::vector<std::size_t>& indices);
 
+    /**
+     * @brief Returns a copy of the full engine state (used by world snapshots).
+     * @return Current engine state.
+     */
+    std::mt19937 engineState() const;
+
+    /**
+     * @brief Replaces the engine state with a previously saved one.
+     * @param state Engine state returned by engineState().
+     */
+    void setEngineState(const std::mt19937& state);
+
 private:
     /**
      * @brief Constructs the RNG with a deterministic default seed.
@@ -0,0 +1,245 @@
+#include "SamplingProfiler.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#if (defined(__linux__) || defined(__APPLE__)) && __has_include(<execinfo.h>)
+#include <cxxabi.h>
+#include <dlfcn.h>
+#include <execinfo.h>
+#include <signal.h>
+#include <sys/time.h>
+#define PACMAN_HAS_SAMPLER 1
+#endif
+
+namespace pacman::logic {
+
+namespace {
+/// Frames above the interrupted function: the handler itself and the kernel's signal trampoline.
+constexpr int kHandlerFrames = 2;
+
+#ifdef PACMAN_HAS_SAMPLER
+/**
+ * @brief Returns a printable name for a code address, caching results.
+ * @param address Code address.
+ * @param cache Names resolved so far.
+ * @return Demangled symbol, "module+0xoffset" or the raw address.
+ */
+const std::string& symbolize(std::uintptr_t address, std::unordered_map<std::uintptr_t, std::string>& cache) {
+    const auto cached = cache.find(address);
+    if (cached != cache.end()) {
+        return cached->second;
+    }
+
+    std::string name;
+    Dl_info info{};
+    if (dladdr(reinterpret_cast<void*>(address), &info) && info.dli_sname) {
+        int status = 0;
+        char* demangled = abi::__cxa_demangle(info.dli_sname, nullptr, nullptr, &status);
+        name = (status == 0 && demangled) ? demangled : info.dli_sname;
+        std::free(demangled);
+    } else if (info.dli_fname) {
+        const std::string module = info.dli_fname;
+        char offset[32];
+        std::snprintf(offset, sizeof(offset), "+0x%llx",
+                      static_cast<unsigned long long>(address - reinterpret_cast<std::uintptr_t>(info.dli_fbase)));
+        name = module.substr(module.find_last_of('/') + 1) + offset;
+    } else {
+        char raw[32];
+        std::snprintf(raw, sizeof(raw), "0x%llx", static_cast<unsigned long long>(address));
+        name = raw;
+    }
+
+    // ';' separates frames in the folded format
+    for (char& c : name) {
+        if (c == ';') {
+            c = ':';
+        }
+    }
+
+    return cache.emplace(address, std::move(name)).first->second;
+}
+#endif
+} // namespace
+
+/**
+ * @brief Returns the singleton SamplingProfiler instance.
+ * @return Reference to the global sampler.
+ */
+SamplingProfiler& SamplingProfiler::getInstance() {
+    static SamplingProfiler instance;
+    return instance;
+}
+
+/**
+ * @brief Allocates the sample pool, installs the SIGPROF handler and starts the timer.
+ * @param hz Samples per second of CPU time.
+ * @param poolWords Size of the sample pool in words.
+ * @return False if sampling is unsupported, already running or the timer could not be set.
+ */
+bool SamplingProfiler::start(unsigned hz, std::size_t poolWords) {
+#ifdef PACMAN_HAS_SAMPLER
+    if (running_ || hz == 0 || poolWords == 0) {
+        return false;
+    }
+
+    // Value-initialized, so every page is touched now rather than inside the handler.
+    pool_ = std::make_unique<std::uintptr_t[]>(poolWords);
+    poolWords_ = poolWords;
+    used_.store(0, std::memory_order_relaxed);
+    samples_.store(0, std::memory_order_relaxed);
+    dropped_.store(0, std::memory_order_relaxed);
+
+    // The first backtrace() call loads the unwinder, which must not happen inside the signal handler.
+    void* warmup[4];
+    backtrace(warmup, 4);
+
+    struct sigaction action{};
+    action.sa_handler = &SamplingProfiler::onSignal;
+    action.sa_flags = SA_RESTART;
+    sigemptyset(&action.sa_mask);
+    if (sigaction(SIGPROF, &action, nullptr) != 0) {
+        return false;
+    }
+
+    recording_.store(true, std::memory_order_release);
+
+    const long intervalUs = hz >= 1000000 ? 1 : static_cast<long>(1000000 / hz);
+    itimerval timer{};
+    timer.it_interval.tv_sec = intervalUs / 1000000;
+    timer.it_interval.tv_usec = static_cast<decltype(timer.it_interval.tv_usec)>(intervalUs % 1000000);
+    timer.it_value = timer.it_interval;
+    if (setitimer(ITIMER_PROF, &timer, nullptr) != 0) {
+        recording_.store(false, std::memory_order_release);
+        return false;
+    }
+
+    running_ = true;
+    return true;
+#else
+    static_cast<void>(hz);
+    static_cast<void>(poolWords);
+    return false;
+#endif
+}
+
+/**
+ * @brief Stops the timer and waits for handlers that are still recording.
+ */
+void SamplingProfiler::stop() {
+#ifdef PACMAN_HAS_SAMPLER
+    if (!running_) {
+        return;
+    }
+
+    itimerval off{};
+    setitimer(ITIMER_PROF, &off, nullptr);
+
+    recording_.store(false, std::memory_order_release);
+    while (inHandler_.load(std::memory_order_acquire) > 0) {
+        std::this_thread::yield();
+    }
+
+    running_ = false;
+#endif
+}
+
+/**
+ * @brief SIGPROF handler: copies the interrupted call stack into the next free words of the pool.
+ *
+ * Only touches atomics and the preallocated pool. The leaf is the interrupted instruction itself; the remaining
+ * frames are return addresses.
+ *
+ * @param signal Signal number.
+ */
+void SamplingProfiler::onSignal(int signal) {
+    static_cast<void>(signal);
+#ifdef PACMAN_HAS_SAMPLER
+    const int savedErrno = errno;
+    SamplingProfiler& self = getInstance();
+
+    self.inHandler_.fetch_add(1, std::memory_order_acq_rel);
+    if (self.recording_.load(std::memory_order_acquire)) {
+        void* frames[MaxDepth + kHandlerFrames];
+        const int depth = backtrace(frames, static_cast<int>(MaxDepth + kHandlerFrames));
+        const std::size_t kept = depth > kHandlerFrames ? static_cast<std::size_t>(depth - kHandlerFrames) : 0;
+
+        if (kept > 0) {
+            const std::size_t at = self.used_.fetch_add(kept + 1, std::memory_order_relaxed);
+            if (at + kept + 1 <= self.poolWords_) {
+                self.pool_[at] = kept;
+                for (std::size_t i = 0; i < kept; ++i) {
+                    self.pool_[at + 1 + i] = reinterpret_cast<std::uintptr_t>(frames[kHandlerFrames + i]);
+                }
+                self.samples_.fetch_add(1, std::memory_order_relaxed);
+            } else {
+                self.dropped_.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+    }
+    self.inHandler_.fetch_sub(1, std::memory_order_release);
+
+    errno = savedErrno;
+#endif
+}
+
+/**
+ * @brief Symbolizes the recorded samples and writes them as folded stacks ("root;...;leaf count", sorted).
+ * @param path Output text file.
+ * @return False if the file could not be written.
+ */
+bool SamplingProfiler::writeFolded(const std::string& path) {
+    stop();
+
+    std::map<std::string, std::uint64_t> stacks;
+#ifdef PACMAN_HAS_SAMPLER
+    std::unordered_map<std::uintptr_t, std::string> names;
+    std::vector<const std::string*> frames;
+
+    const std::size_t end = std::min(used_.load(std::memory_order_relaxed), poolWords_);
+    std::size_t pos = 0;
+    while (pos < end) {
+        const std::size_t depth = pool_[pos];
+        if (depth == 0 || pos + 1 + depth > end) {
+            break;
+        }
+
+        frames.clear();
+        for (std::size_t i = 0; i < depth; ++i) {
+            // Return addresses point after the call; look up the call instruction itself.
+            const std::uintptr_t address = pool_[pos + 1 + i];
+            frames.push_back(&symbolize(i == 0 ? address : address - 1, names));
+        }
+
+        std::string folded;
+        for (auto it = frames.rbegin(); it != frames.rend(); ++it) {
+            if (!folded.empty()) {
+                folded += ';';
+            }
+            folded += **it;
+        }
+        ++stacks[folded];
+
+        pos += depth + 1;
+    }
+#endif
+
+    std::ofstream out(path, std::ios::trunc);
+    if (!out) {
+        return false;
+    }
+    for (const auto& [stack, count] : stacks) {
+        out << stack << ' ' << count << '\n';
+    }
+    return static_cast<bool>(out);
+}
+
+} // namespace pacman::logic
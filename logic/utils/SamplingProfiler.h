@@ -0,0 +1,99 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace pacman::logic {
+
+/**
+ * @brief Singleton statistical profiler: SIGPROF interrupts record call stacks, written as folded stacks at exit.
+ *
+ * start() arms an ITIMER_PROF timer, so every thread that burns CPU (render and simulation thread alike) is
+ * interrupted at roughly the requested rate; kernels may round the interval up to their timer tick. The signal
+ * handler unwinds the interrupted stack with backtrace() into a pool of return addresses allocated up front; it
+ * never allocates or locks, and samples that do not fit are only counted. writeFolded() resolves the addresses with
+ * dladdr after stop() and writes one "root;...;leaf count" line per distinct stack, the input format of
+ * flamegraph.pl and speedscope. Functions without a dynamic symbol are written as "module+0xoffset" (resolve with
+ * addr2line); the executables export their symbols for this.
+ *
+ * The handler stays installed after stop() and ignores late signals, since a SIGPROF still pending would otherwise
+ * terminate the process. Only available on POSIX systems with execinfo (Linux, macOS); elsewhere start() fails.
+ */
+class SamplingProfiler {
+public:
+    static constexpr unsigned DefaultHz = 997;                ///< Off the 60 Hz frame rate so samples do not alias
+    static constexpr std::size_t DefaultPoolWords = 1u << 21; ///< Return addresses kept (16 MiB on 64-bit)
+    static constexpr std::size_t MaxDepth = 64;               ///< Frames recorded per sample
+
+    /**
+     * @brief Returns the singleton SamplingProfiler instance.
+     * @return Reference to the global sampler.
+     */
+    static SamplingProfiler& getInstance();
+
+    /**
+     * @brief Allocates the sample pool, installs the SIGPROF handler and starts the timer.
+     * @param hz Samples per second of CPU time.
+     * @param poolWords Size of the sample pool in words (each sample takes its depth plus one).
+     * @return False if sampling is unsupported, already running or the timer could not be set.
+     */
+    bool start(unsigned hz = DefaultHz, std::size_t poolWords = DefaultPoolWords);
+
+    /**
+     * @brief Stops the timer and waits for handlers that are still recording.
+     */
+    void stop();
+
+    /**
+     * @brief Returns whether the sampler is running.
+     * @return True between start() and stop().
+     */
+    bool running() const noexcept { return running_; }
+
+    /**
+     * @brief Returns the number of samples recorded.
+     * @return Sample count.
+     */
+    std::uint64_t samples() const noexcept { return samples_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Returns the number of samples dropped because the pool was full.
+     * @return Dropped sample count.
+     */
+    std::uint64_t dropped() const noexcept { return dropped_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Symbolizes the recorded samples and writes them as folded stacks; stops the sampler first.
+     * @param path Output text file.
+     * @return False if the file could not be written.
+     */
+    bool writeFolded(const std::string& path);
+
+private:
+    SamplingProfiler() = default;
+    ~SamplingProfiler() = default;
+
+    SamplingProfiler(const SamplingProfiler&) = delete;
+    SamplingProfiler& operator=(const SamplingProfiler&) = delete;
+
+    /**
+     * @brief SIGPROF handler: records the interrupted call stack into the pool.
+     * @param signal Signal number.
+     */
+    static void onSignal(int signal);
+
+private:
+    std::unique_ptr<std::uintptr_t[]> pool_; ///< Per sample: depth, then depth return addresses (leaf first)
+    std::size_t poolWords_{0};
+    std::atomic<std::size_t> used_{0};
+    std::atomic<std::uint64_t> samples_{0};
+    std::atomic<std::uint64_t> dropped_{0};
+    std::atomic<int> inHandler_{0}; ///< Handlers currently writing, waited for by stop()
+    std::atomic<bool> recording_{false};
+    bool running_{false};
+};
+
+} // namespace pacman::logic
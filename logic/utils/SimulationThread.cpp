@@ -0,0 +1,143 @@
+#include "SimulationThread.h"
+
+#include "TraceRecorder.h"
+
+#include <utility>
+
+namespace pacman::logic {
+
+namespace {
+constexpr double kMaxLagSeconds = 0.25; ///< Backlog after which missed ticks are dropped
+} // namespace
+
+/**
+ * @brief Starts the (paused) worker thread.
+ * @param tickDt Time between steps in seconds.
+ * @param step Function called once per tick with the tick's scheduled time; returns false to pause.
+ */
+SimulationThread::SimulationThread(double tickDt, Step step)
+    : tickDt_(tickDt),
+      tick_(std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(tickDt))),
+      step_(std::move(step)), thread_([this] { run(); }) {}
+
+/**
+ * @brief Stops and joins the worker thread.
+ */
+SimulationThread::~SimulationThread() {
+    {
+        std::scoped_lock lock(mtx_);
+        stop_ = true;
+    }
+    cv_.notify_all();
+
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+}
+
+/**
+ * @brief Starts or continues stepping.
+ */
+void SimulationThread::resume() {
+    std::unique_lock lock(mtx_);
+    rethrowFailure(lock);
+
+    if (!running_) {
+        running_ = true;
+        cv_.notify_all();
+    }
+}
+
+/**
+ * @brief Stops stepping and waits for a step in progress to finish.
+ */
+void SimulationThread::pause() {
+    std::unique_lock lock(mtx_);
+    running_ = false;
+    cv_.notify_all();
+    cv_.wait(lock, [this] { return !stepping_; });
+
+    rethrowFailure(lock);
+}
+
+/**
+ * @brief Returns whether the thread is currently stepping.
+ * @return False after pause() or after the step paused itself.
+ */
+bool SimulationThread::running() const {
+    std::scoped_lock lock(mtx_);
+    return running_;
+}
+
+/**
+ * @brief Rethrows an exception captured on the worker thread, if any.
+ * @param lock Held lock on mtx_ (released before throwing).
+ */
+void SimulationThread::rethrowFailure(std::unique_lock<std::mutex>& lock) {
+    if (!failure_) {
+        return;
+    }
+
+    auto failure = std::exchange(failure_, nullptr);
+    lock.unlock();
+    std::rethrow_exception(failure);
+}
+
+/**
+ * @brief Thread body: waits for resume(), then steps on fixed deadlines until paused or stopped.
+ *
+ * The lock is released while the step runs, so pause() and resume() never wait for more than one step.
+ */
+void SimulationThread::run() {
+    const auto maxLag = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(kMaxLagSeconds));
+
+    TraceRecorder::getInstance().registerThread("simulation");
+
+    std::unique_lock lock(mtx_);
+    Clock::time_point next = Clock::now();
+
+    while (!stop_) {
+        if (!running_) {
+            cv_.wait(lock, [this] { return stop_ || running_; });
+            next = Clock::now() + tick_;
+            continue;
+        }
+
+        if (cv_.wait_until(lock, next, [this] { return stop_ || !running_; })) {
+            continue;
+        }
+
+        stepping_ = true;
+        lock.unlock();
+
+        bool keepRunning = false;
+        std::exception_ptr failure;
+        try {
+            PACMAN_TRACE_SCOPE("sim", "step");
+            keepRunning = step_(next);
+        } catch (...) {
+            failure = std::current_exception();
+        }
+
+        lock.lock();
+        stepping_ = false;
+        if (failure) {
+            failure_ = failure;
+        }
+        if (!keepRunning) {
+            running_ = false;
+        }
+        cv_.notify_all();
+
+        next += tick_;
+        const auto now = Clock::now();
+        if (now - next > maxLag) {
+            if (tick_ > Clock::duration::zero()) {
+                droppedTicks_.fetch_add(static_cast<std::uint64_t>((now - next) / tick_), std::memory_order_relaxed);
+            }
+            next = now;
+        }
+    }
+}
+
+} // namespace pacman::logic
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace pacman::logic {
+
+/**
+ * @brief Worker thread that calls a step function at a fixed rate.
+ *
+ * The thread starts paused. While running it calls the step once per tick on steady_clock deadlines and passes
+ * the deadline along, so the step can tell which timestamped events belong to it even when it runs late. If the
+ * thread falls more than a quarter second behind (debugger, suspended process) it drops the backlog instead of
+ * catching up in a burst and counts the dropped ticks (droppedTicks()). The step returns false to pause itself,
+ * e.g. when the owner has to handle a state transition.
+ *
+ * pause() only returns once no step is in progress, so the owner may touch the stepped data between pause() and
+ * resume(). An exception thrown by the step pauses the thread and is rethrown by the next resume() or pause().
+ */
+class SimulationThread {
+public:
+    using Clock = std::chrono::steady_clock;
+    using Step = std::function<bool(Clock::time_point deadline)>;
+
+    /**
+     * @brief Starts the (paused) worker thread.
+     * @param tickDt Time between steps in seconds.
+     * @param step Function called once per tick with the tick's scheduled time; returns false to pause.
+     */
+    SimulationThread(double tickDt, Step step);
+
+    /**
+     * @brief Stops and joins the worker thread.
+     */
+    ~SimulationThread();
+
+    SimulationThread(const SimulationThread&) = delete;
+    SimulationThread& operator=(const SimulationThread&) = delete;
+
+    /**
+     * @brief Starts or continues stepping; the first step happens one tick from now.
+     */
+    void resume();
+
+    /**
+     * @brief Stops stepping and waits for a step in progress to finish.
+     */
+    void pause();
+
+    /**
+     * @brief Returns whether the thread is currently stepping.
+     * @return False after pause() or after the step paused itself.
+     */
+    bool running() const;
+
+    /**
+     * @brief Returns the time between steps.
+     * @return Tick duration in seconds.
+     */
+    double tickDt() const noexcept { return tickDt_; }
+
+    /**
+     * @brief Returns how many ticks were dropped so far because the thread fell too far behind.
+     * @return Dropped tick count; safe to read from any thread.
+     */
+    std::uint64_t droppedTicks() const noexcept { return droppedTicks_.load(std::memory_order_relaxed); }
+
+private:
+    /**
+     * @brief Thread body: waits for resume(), then steps until paused or stopped.
+     */
+    void run();
+
+    /**
+     * @brief Rethrows an exception captured on the worker thread, if any.
+     * @param lock Held lock on mtx_.
+     */
+    void rethrowFailure(std::unique_lock<std::mutex>& lock);
+
+private:
+    double tickDt_;
+    Clock::duration tick_;
+    Step step_;
+
+    mutable std::mutex mtx_;
+    std::condition_variable cv_;
+    bool running_{false};
+    bool stepping_{false};
+    bool stop_{false};
+    std::exception_ptr failure_;
+    std::atomic<std::uint64_t> droppedTicks_{0};
+
+    std::thread thread_; ///< Declared last so it starts after all other members are initialized
+};
+
+} // namespace pacman::logic
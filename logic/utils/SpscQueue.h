@@ -0,0 +1,73 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+namespace pacman::logic {
+
+/**
+ * @brief Bounded lock-free single-producer/single-consumer ring buffer.
+ *
+ * One thread pushes, another peeks and pops; neither ever blocks. Storage is fixed at compile time, so pushing
+ * never allocates and fails instead when the queue is full.
+ *
+ * @tparam T Element type (copied in and out).
+ * @tparam Capacity Number of slots; must be a power of two.
+ */
+template <typename T, std::size_t Capacity>
+class SpscQueue {
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "SpscQueue capacity must be a power of two");
+
+public:
+    /**
+     * @brief Appends an element (producer side).
+     * @param value Element to copy in.
+     * @return False if the queue is full and the element was dropped.
+     */
+    bool tryPush(const T& value) noexcept {
+        const std::size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail - head_.load(std::memory_order_acquire) == Capacity) {
+            return false;
+        }
+
+        slots_[tail & (Capacity - 1)] = value;
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Returns the oldest element without removing it (consumer side).
+     * @return Pointer to the oldest element, or nullptr if the queue is empty. Valid until pop().
+     */
+    const T* peek() const noexcept {
+        const std::size_t head = head_.load(std::memory_order_relaxed);
+        if (head == tail_.load(std::memory_order_acquire)) {
+            return nullptr;
+        }
+        return &slots_[head & (Capacity - 1)];
+    }
+
+    /**
+     * @brief Removes the oldest element (consumer side); no effect if the queue is empty.
+     */
+    void pop() noexcept {
+        const std::size_t head = head_.load(std::memory_order_relaxed);
+        if (head != tail_.load(std::memory_order_acquire)) {
+            head_.store(head + 1, std::memory_order_release);
+        }
+    }
+
+    /**
+     * @brief Removes all queued elements (consumer side).
+     */
+    void clear() noexcept { head_.store(tail_.load(std::memory_order_acquire), std::memory_order_release); }
+
+private:
+    std::array<T, Capacity> slots_{};
+
+    alignas(64) std::atomic<std::size_t> head_{0}; ///< Next slot to read, owned by the consumer
+    alignas(64) std::atomic<std::size_t> tail_{0}; ///< Next slot to write, owned by the producer
+};
+
+} // namespace pacman::logic
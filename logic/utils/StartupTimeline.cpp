@@ -0,0 +1,109 @@
+#include "StartupTimeline.h"
+
+#include "TraceRecorder.h"
+
+#include <chrono>
+#include <iomanip>
+#include <sstream>
+#include <thread>
+
+namespace pacman::logic {
+
+namespace {
+/// Taken during static initialization, the closest portable stand-in for the process start.
+const std::chrono::steady_clock::time_point kProcessStart = std::chrono::steady_clock::now();
+
+/**
+ * @brief Returns a printable id of the calling thread.
+ */
+std::string threadId() {
+    std::ostringstream out;
+    out << std::this_thread::get_id();
+    return out.str();
+}
+} // namespace
+
+/**
+ * @brief Returns the singleton StartupTimeline instance.
+ * @return Reference to the global timeline.
+ */
+StartupTimeline& StartupTimeline::getInstance() {
+    static StartupTimeline timeline;
+    return timeline;
+}
+
+/**
+ * @brief Returns the time since the process started.
+ * @return Nanoseconds since static initialization.
+ */
+std::int64_t StartupTimeline::sinceStartNs() noexcept {
+    const auto elapsed = std::chrono::steady_clock::now() - kProcessStart;
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+}
+
+/**
+ * @brief Records a step now, unless the same name and detail were recorded before.
+ * @param name Step name (string literal).
+ * @param detail Optional detail (copied).
+ */
+void StartupTimeline::mark(const char* name, std::string_view detail) {
+    const std::int64_t now = sinceStartNs();
+    const std::string thread = threadId();
+
+    {
+        std::scoped_lock lock(mtx_);
+
+        for (const Mark& m : marks_) {
+            if (std::string_view(m.name) == name && m.detail == detail) {
+                return;
+            }
+        }
+
+        if (marks_.empty()) {
+            mainThread_ = thread;
+        }
+        marks_.push_back(Mark{name, std::string(detail), now, thread == mainThread_});
+    }
+
+    TraceRecorder::getInstance().record('i', "startup", name, detail);
+}
+
+/**
+ * @brief Returns all marks in the order they were made.
+ * @return Copy of the marks.
+ */
+std::vector<StartupTimeline::Mark> StartupTimeline::marks() const {
+    std::scoped_lock lock(mtx_);
+    return marks_;
+}
+
+/**
+ * @brief Formats the marks as a table, in the order they were made.
+ * @return Multi-line report (empty if nothing was marked).
+ */
+std::string StartupTimeline::report() const {
+    const std::vector<Mark> all = marks();
+    if (all.empty()) {
+        return {};
+    }
+
+    std::ostringstream out;
+    out << std::fixed << std::setprecision(1);
+    out << "startup (ms)     +ms  thread  step\n";
+
+    std::int64_t previous = 0;
+    for (const Mark& m : all) {
+        out << std::setw(12) << static_cast<double>(m.sinceStartNs) / 1e6 << std::setw(8)
+            << static_cast<double>(m.sinceStartNs - previous) / 1e6 << "  " << std::left << std::setw(6)
+            << (m.mainThread ? "main" : "worker") << std::right << "  " << m.name;
+        if (!m.detail.empty()) {
+            out << " (" << m.detail << ')';
+        }
+        out << '\n';
+        previous = m.sinceStartNs;
+    }
+
+    return out.str();
+}
+
+} // namespace pacman::logic
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace pacman::logic {
+
+/**
+ * @brief Singleton recording when the steps from process start to an interactive game happen.
+ *
+ * Each mark stores the time since the process started (taken during static initialization, so before main()) and
+ * the thread it was made on. Only the first occurrence of a name and detail is kept, so code that runs again later
+ * (e.g. every level load) only contributes its startup cost. Marks are also written as instant events to the
+ * TraceRecorder when tracing is enabled. All methods are thread-safe; marks are rare, so a mutex is sufficient.
+ */
+class StartupTimeline {
+public:
+    /**
+     * @brief One recorded step.
+     */
+    struct Mark {
+        const char* name{nullptr};    ///< Step name (string literal)
+        std::string detail;           ///< Optional detail, e.g. an asset path
+        std::int64_t sinceStartNs{0}; ///< Time since the process started
+        bool mainThread{false};       ///< Made on the thread that was first to mark
+    };
+
+    /**
+     * @brief Returns the singleton StartupTimeline instance.
+     * @return Reference to the global timeline.
+     */
+    static StartupTimeline& getInstance();
+
+    /**
+     * @brief Records a step now, unless the same name and detail were recorded before.
+     * @param name Step name (string literal).
+     * @param detail Optional detail (copied).
+     */
+    void mark(const char* name, std::string_view detail = {});
+
+    /**
+     * @brief Returns the time since the process started.
+     * @return Nanoseconds since static initialization.
+     */
+    static std::int64_t sinceStartNs() noexcept;
+
+    /**
+     * @brief Returns all marks in the order they were made.
+     * @return Copy of the marks.
+     */
+    std::vector<Mark> marks() const;
+
+    /**
+     * @brief Formats the marks as a table: time since start, time since the previous mark, thread and step.
+     * @return Multi-line report (empty if nothing was marked).
+     */
+    std::string report() const;
+
+private:
+    StartupTimeline() = default;
+    ~StartupTimeline() = default;
+
+    StartupTimeline(const StartupTimeline&) = delete;
+    StartupTimeline& operator=(const StartupTimeline&) = delete;
+
+private:
+    mutable std::mutex mtx_;
+    std::vector<Mark> marks_;
+    std::string mainThread_; ///< Id of the thread that made the first mark
+};
+
+} // namespace pacman::logic
@@ -0,0 +1,230 @@
+#include "TraceRecorder.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+
+namespace pacman::logic {
+
+namespace {
+/**
+ * @brief Releases the calling thread's buffer for reuse when the thread exits.
+ */
+struct ThreadSlot {
+    void* buffer{nullptr};
+    std::atomic<bool>* owned{nullptr};
+
+    ~ThreadSlot() {
+        if (owned) {
+            owned->store(false, std::memory_order_release);
+        }
+    }
+};
+
+thread_local ThreadSlot tThreadSlot;
+
+/**
+ * @brief Writes a string as a JSON string literal.
+ * @param out Output stream.
+ * @param text Text to escape.
+ */
+void writeJsonString(std::ostream& out, std::string_view text) {
+    out << '"';
+    for (const char c : text) {
+        if (c == '"' || c == '\\') {
+            out << '\\' << c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            out << ' ';
+        } else {
+            out << c;
+        }
+    }
+    out << '"';
+}
+} // namespace
+
+/**
+ * @brief Returns the singleton TraceRecorder instance.
+ * @return Reference to the global recorder.
+ */
+TraceRecorder& TraceRecorder::getInstance() {
+    static TraceRecorder instance;
+    return instance;
+}
+
+/**
+ * @brief Returns the steady clock time in nanoseconds.
+ * @return Nanoseconds since the steady clock's epoch.
+ */
+std::int64_t TraceRecorder::nowNs() noexcept {
+    const auto now = std::chrono::steady_clock::now().time_since_epoch();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(now).count();
+}
+
+/**
+ * @brief Names the calling thread and allocates its buffer if recording is enabled.
+ * @param name Thread name shown in the trace.
+ */
+void TraceRecorder::registerThread(const char* name) {
+    if (!enabled()) {
+        return;
+    }
+
+    if (auto* buffer = static_cast<ThreadBuffer*>(tThreadSlot.buffer)) {
+        std::scoped_lock lock(mtx_);
+        buffer->name = name;
+        return;
+    }
+    acquireBuffer(name);
+}
+
+/**
+ * @brief Returns the calling thread's buffer, registering it on first use.
+ * @return Buffer, or nullptr if it could not be allocated.
+ */
+TraceRecorder::ThreadBuffer* TraceRecorder::threadBuffer() {
+    if (auto* buffer = static_cast<ThreadBuffer*>(tThreadSlot.buffer)) {
+        return buffer;
+    }
+
+    try {
+        return acquireBuffer(nullptr);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+/**
+ * @brief Assigns a buffer whose thread exited, or allocates a new one.
+ *
+ * A reused buffer keeps its unflushed events; the new owner only appends, so the queue keeps a single writer.
+ *
+ * @param name Thread name (may be null).
+ * @return Assigned buffer.
+ */
+TraceRecorder::ThreadBuffer* TraceRecorder::acquireBuffer(const char* name) {
+    std::scoped_lock lock(mtx_);
+
+    ThreadBuffer* buffer = nullptr;
+    for (auto& candidate : buffers_) {
+        bool expected = false;
+        if (candidate->owned.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+            buffer = candidate.get();
+            break;
+        }
+    }
+
+    if (!buffer) {
+        buffers_.push_back(std::make_unique<ThreadBuffer>());
+        buffer = buffers_.back().get();
+        buffer->tid = static_cast<std::uint32_t>(buffers_.size());
+        buffer->owned.store(true, std::memory_order_release);
+    }
+
+    buffer->name = name;
+    tThreadSlot.buffer = buffer;
+    tThreadSlot.owned = &buffer->owned;
+    return buffer;
+}
+
+/**
+ * @brief Records an event on the calling thread's buffer.
+ * @param phase 'B', 'E' or 'i'.
+ * @param category Category.
+ * @param name Event name.
+ * @param detail Optional detail (copied, keeping its last characters).
+ * @return False if recording is disabled or the buffer is full.
+ */
+bool TraceRecorder::record(char phase, const char* category, const char* name, std::string_view detail) noexcept {
+    if (!enabled()) {
+        return false;
+    }
+
+    ThreadBuffer* buffer = threadBuffer();
+    if (!buffer) {
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    TraceEvent event{};
+    event.category = category;
+    event.name = name;
+    event.timeNs = nowNs();
+    event.phase = phase;
+
+    const std::size_t length = std::min(detail.size(), sizeof(event.detail) - 1);
+    detail.substr(detail.size() - length).copy(event.detail, length);
+
+    if (!buffer->events.tryPush(event)) {
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Drains all thread buffers and writes the whole trace recorded so far as Chrome trace JSON.
+ *
+ * Timestamps are microseconds since the recorder was created. Thread names are written as metadata events.
+ *
+ * @param path Output file.
+ * @return False if the file could not be written.
+ */
+bool TraceRecorder::flush(const std::string& path) {
+    std::scoped_lock lock(mtx_);
+
+    for (const auto& buffer : buffers_) {
+        while (const TraceEvent* event = buffer->events.peek()) {
+            collected_.push_back(Collected{*event, buffer->tid});
+            buffer->events.pop();
+        }
+    }
+
+    std::ofstream out(path, std::ios::trunc);
+    if (!out) {
+        return false;
+    }
+
+    out << "{\"traceEvents\":[\n";
+    bool first = true;
+    const auto separator = [&out, &first] {
+        if (!first) {
+            out << ",\n";
+        }
+        first = false;
+    };
+
+    for (const auto& buffer : buffers_) {
+        separator();
+        out << R"({"ph":"M","pid":1,"tid":)" << buffer->tid << R"(,"name":"thread_name","args":{"name":)";
+        writeJsonString(out, buffer->name ? buffer->name : "thread");
+        out << "}}";
+    }
+
+    char ts[32];
+    for (const auto& c : collected_) {
+        const TraceEvent& e = c.event;
+        std::snprintf(ts, sizeof(ts), "%.3f", static_cast<double>(e.timeNs - originNs_) / 1000.0);
+
+        separator();
+        out << R"({"ph":")" << e.phase << R"(","pid":1,"tid":)" << c.tid << R"(,"ts":)" << ts << R"(,"cat":)";
+        writeJsonString(out, e.category ? e.category : "");
+        out << R"(,"name":)";
+        writeJsonString(out, e.name ? e.name : "");
+        if (e.phase == 'i') {
+            out << R"(,"s":"t")";
+        }
+        if (e.detail[0] != '\0') {
+            out << R"(,"args":{"detail":)";
+            writeJsonString(out, e.detail);
+            out << '}';
+        }
+        out << '}';
+    }
+
+    out << "\n],\"otherData\":{\"droppedEvents\":" << dropped() << "}}\n";
+    return static_cast<bool>(out);
+}
+
+} // namespace pacman::logic
@@ -0,0 +1,192 @@
+#pragma once
+
+#include "SpscQueue.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace pacman::logic {
+
+/**
+ * @brief One trace event as stored in a thread's buffer.
+ *
+ * Category and name must be string literals (only the pointers are stored); the optional detail is copied and
+ * truncated to its last characters, which keeps the informative end of file paths.
+ */
+struct TraceEvent {
+    static constexpr std::size_t DetailSize = 24;
+
+    const char* category{nullptr};
+    const char* name{nullptr};
+    std::int64_t timeNs{0};
+    char phase{'i'}; ///< 'B' begin, 'E' end, 'i' instant (Chrome trace phases)
+    char detail[DetailSize - 1]{};
+};
+
+/**
+ * @brief Singleton recording begin/end spans and instant events for the Chrome trace viewer and Perfetto.
+ *
+ * Every thread writes into its own pre-allocated lock-free queue, so recording never allocates or blocks and
+ * does not disturb frame timing; events that do not fit are dropped and counted. flush() drains all queues and
+ * writes everything recorded so far as Chrome trace JSON, so it can be called repeatedly during a session.
+ *
+ * Recording is off until setEnabled(true). Threads should call registerThread() before their first event so the
+ * buffer is allocated up front and the thread is named in the trace.
+ */
+class TraceRecorder {
+public:
+    static constexpr std::size_t EventsPerThread = std::size_t{1} << 17;
+
+    /**
+     * @brief Returns the singleton TraceRecorder instance.
+     * @return Reference to the global recorder.
+     */
+    static TraceRecorder& getInstance();
+
+    /**
+     * @brief Enables or disables recording.
+     * @param enabled New state.
+     */
+    void setEnabled(bool enabled) noexcept { enabled_.store(enabled, std::memory_order_relaxed); }
+
+    /**
+     * @brief Returns whether recording is enabled.
+     * @return True if events are recorded.
+     */
+    bool enabled() const noexcept { return enabled_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Names the calling thread and allocates its buffer if recording is enabled.
+     * @param name Thread name shown in the trace (string literal).
+     */
+    void registerThread(const char* name);
+
+    /**
+     * @brief Records an event on the calling thread's buffer.
+     * @param phase 'B', 'E' or 'i'.
+     * @param category Category (string literal).
+     * @param name Event name (string literal).
+     * @param detail Optional detail shown as an argument (copied, truncated).
+     * @return False if recording is disabled or the buffer is full.
+     */
+    bool record(char phase, const char* category, const char* name, std::string_view detail = {}) noexcept;
+
+    /**
+     * @brief Drains all thread buffers and writes the whole trace recorded so far.
+     * @param path Output file (Chrome trace JSON).
+     * @return False if the file could not be written.
+     */
+    bool flush(const std::string& path);
+
+    /**
+     * @brief Returns the number of events dropped because a buffer was full.
+     * @return Dropped event count.
+     */
+    std::uint64_t dropped() const noexcept { return dropped_.load(std::memory_order_relaxed); }
+
+private:
+    TraceRecorder() = default;
+    ~TraceRecorder() = default;
+
+    TraceRecorder(const TraceRecorder&) = delete;
+    TraceRecorder& operator=(const TraceRecorder&) = delete;
+
+    /**
+     * @brief Buffer of one thread; reused by a later thread once its owner exited.
+     */
+    struct ThreadBuffer {
+        SpscQueue<TraceEvent, EventsPerThread> events;
+        std::uint32_t tid{0};
+        const char* name{nullptr};
+        std::atomic<bool> owned{false};
+    };
+
+    /**
+     * @brief Drained event tagged with the thread it came from.
+     */
+    struct Collected {
+        TraceEvent event;
+        std::uint32_t tid{0};
+    };
+
+    /**
+     * @brief Returns the calling thread's buffer, registering it on first use.
+     * @return Buffer, or nullptr if it could not be allocated.
+     */
+    ThreadBuffer* threadBuffer();
+
+    /**
+     * @brief Assigns a free or new buffer to the calling thread.
+     * @param name Thread name (may be null).
+     * @return Assigned buffer.
+     */
+    ThreadBuffer* acquireBuffer(const char* name);
+
+private:
+    std::atomic<bool> enabled_{false};
+    std::atomic<std::uint64_t> dropped_{0};
+    const std::int64_t originNs_{nowNs()};
+
+    std::mutex mtx_; ///< Guards buffers_ and collected_ (registration and flush only)
+    std::vector<std::unique_ptr<ThreadBuffer>> buffers_;
+    std::vector<Collected> collected_;
+
+    /**
+     * @brief Returns the steady clock time in nanoseconds.
+     * @return Nanoseconds since the steady clock's epoch.
+     */
+    static std::int64_t nowNs() noexcept;
+};
+
+/**
+ * @brief Records a begin event on construction and the matching end event on destruction; use PACMAN_TRACE_SCOPE.
+ */
+class TraceScope {
+public:
+    /**
+     * @brief Records the begin event if recording is enabled.
+     * @param category Category (string literal).
+     * @param name Span name (string literal).
+     * @param detail Optional detail (copied).
+     */
+    TraceScope(const char* category, const char* name, std::string_view detail = {}) noexcept
+        : category_(category), name_(name) {
+        active_ = TraceRecorder::getInstance().record('B', category, name, detail);
+    }
+
+    /**
+     * @brief Records the end event if the begin event was recorded.
+     */
+    ~TraceScope() {
+        if (active_) {
+            TraceRecorder::getInstance().record('E', category_, name_);
+        }
+    }
+
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+
+private:
+    const char* category_;
+    const char* name_;
+    bool active_{false};
+};
+
+} // namespace pacman::logic
+
+#define PACMAN_TRACE_CONCAT_INNER(a, b) a##b
+#define PACMAN_TRACE_CONCAT(a, b) PACMAN_TRACE_CONCAT_INNER(a, b)
+
+/// Records the rest of the enclosing scope as a span; extra arguments are an optional detail string.
+#define PACMAN_TRACE_SCOPE(category, ...)                                                                          \
+    const ::pacman::logic::TraceScope PACMAN_TRACE_CONCAT(pacmanTraceScope, __LINE__) { category, __VA_ARGS__ }
+
+/// Records an instant event; extra arguments are an optional detail string.
+#define PACMAN_TRACE_INSTANT(category, ...)                                                                        \
+    ::pacman::logic::TraceRecorder::getInstance().record('i', category, __VA_ARGS__)
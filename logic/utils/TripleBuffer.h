@@ -0,0 +1,66 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace pacman::logic {
+
+/**
+ * @brief Lock-free single-producer/single-consumer triple buffer.
+ *
+ * The producer fills writeBuffer() and publish()es it; the consumer calls update() and reads readBuffer(). Each
+ * side owns one buffer and the third is parked in an atomic slot, so neither side ever waits and the consumer
+ * always sees the most recently published value. Intermediate values the consumer did not pick up are dropped.
+ *
+ * @tparam T Value type (copied into the producer's buffer, never moved between buffers).
+ */
+template <typename T>
+class TripleBuffer {
+public:
+    /**
+     * @brief Returns the buffer the producer may fill.
+     * @return Reference to the producer's buffer (stays valid until publish()).
+     */
+    T& writeBuffer() noexcept { return buffers_[write_]; }
+
+    /**
+     * @brief Hands the producer's buffer to the consumer and takes the parked one for the next write.
+     */
+    void publish() noexcept {
+        const std::uint8_t previous =
+            shared_.exchange(static_cast<std::uint8_t>(write_ | FreshBit), std::memory_order_acq_rel);
+        write_ = previous & IndexMask;
+    }
+
+    /**
+     * @brief Picks up the most recently published buffer, if there is a new one.
+     * @return True if readBuffer() now refers to a newer value.
+     */
+    bool update() noexcept {
+        if ((shared_.load(std::memory_order_relaxed) & FreshBit) == 0) {
+            return false;
+        }
+
+        const std::uint8_t previous = shared_.exchange(read_, std::memory_order_acq_rel);
+        read_ = previous & IndexMask;
+        return true;
+    }
+
+    /**
+     * @brief Returns the buffer the consumer currently reads.
+     * @return Reference to the consumer's buffer (stays valid until the next update()).
+     */
+    const T& readBuffer() const noexcept { return buffers_[read_]; }
+
+private:
+    static constexpr std::uint8_t IndexMask = 0x3;
+    static constexpr std::uint8_t FreshBit = 0x4;
+
+    T buffers_[3]{};
+
+    alignas(64) std::uint8_t write_{0};              ///< Producer-owned index
+    alignas(64) std::atomic<std::uint8_t> shared_{1}; ///< Parked index plus FreshBit
+    alignas(64) std::uint8_t read_{2};               ///< Consumer-owned index
+};
+
+} // namespace pacman::logic
@@ -0,0 +1,100 @@
+#include "BroadPhase.h"
+
+#include <cmath>
+
+namespace pacman::logic {
+
+/**
+ * @brief Sets the grid geometry; invalid sizes fall back to a single cell, i.e. the brute-force scan.
+ * @param originX World-space X of the grid's left edge.
+ * @param originY World-space Y of the grid's bottom edge.
+ * @param cellSize Edge length of a cell.
+ * @param cols Number of columns.
+ * @param rows Number of rows.
+ */
+void BroadPhase::setGrid(float originX, float originY, float cellSize, int cols, int rows) {
+    if (cellSize <= 0.0f || cols < 1 || rows < 1) {
+        originX = -1.0f;
+        originY = -1.0f;
+        cellSize = 2.0f;
+        cols = 1;
+        rows = 1;
+    }
+
+    originX_ = originX;
+    originY_ = originY;
+    cellSize_ = cellSize;
+    cols_ = cols;
+    rows_ = rows;
+}
+
+/**
+ * @brief Returns the cells covered by the closed rectangle, clamped to the grid.
+ *
+ * Entities outside the map land in the border cells, which keeps the result exact: a shared point of two
+ * rectangles clamps to the same cell for both.
+ *
+ * @param r World-space rectangle.
+ * @return Inclusive cell range.
+ */
+BroadPhase::CellRange BroadPhase::cellsOf(const Rect& r) const noexcept {
+    const auto column = [this](float x) {
+        const float c = std::floor((x - originX_) / cellSize_);
+        return static_cast<int>(std::clamp(c, 0.0f, static_cast<float>(cols_ - 1)));
+    };
+    const auto row = [this](float y) {
+        const float c = std::floor((y - originY_) / cellSize_);
+        return static_cast<int>(std::clamp(c, 0.0f, static_cast<float>(rows_ - 1)));
+    };
+
+    return CellRange{column(r.x), row(r.y), column(r.x + r.w), row(r.y + r.h)};
+}
+
+/**
+ * @brief Registers the entities accepted by the filter in the grid with a counting sort.
+ * @param entities Entity list; indices refer to this list.
+ * @param include Filter deciding which entities take part.
+ */
+void BroadPhase::build(const std::vector<std::shared_ptr<Entity>>& entities, bool (*include)(const Entity&)) {
+    const std::size_t cells = static_cast<std::size_t>(cols_) * static_cast<std::size_t>(rows_);
+
+    ranges_.resize(entities.size());
+    members_.clear();
+    cellStart_.assign(cells + 1, 0);
+
+    for (std::size_t i = 0; i < entities.size(); ++i) {
+        const auto& e = entities[i];
+        if (!e || !include(*e)) {
+            continue;
+        }
+
+        const CellRange range = cellsOf(e->bounds());
+        ranges_[i] = range;
+        members_.push_back(static_cast<std::uint32_t>(i));
+
+        for (int y = range.y0; y <= range.y1; ++y) {
+            for (int x = range.x0; x <= range.x1; ++x) {
+                ++cellStart_[static_cast<std::size_t>(y) * cols_ + static_cast<std::size_t>(x) + 1];
+            }
+        }
+    }
+
+    for (std::size_t c = 0; c < cells; ++c) {
+        cellStart_[c + 1] += cellStart_[c];
+    }
+
+    items_.resize(cellStart_[cells]);
+    cursor_.assign(cellStart_.begin(), cellStart_.end() - 1);
+
+    for (const std::uint32_t i : members_) {
+        const CellRange range = ranges_[i];
+        for (int y = range.y0; y <= range.y1; ++y) {
+            for (int x = range.x0; x <= range.x1; ++x) {
+                const std::size_t cell = static_cast<std::size_t>(y) * cols_ + static_cast<std::size_t>(x);
+                items_[cursor_[cell]++] = i;
+            }
+        }
+    }
+}
+
+} // namespace pacman::logic
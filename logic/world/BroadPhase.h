@@ -0,0 +1,129 @@
+#pragma once
+
+#include "../entities/Entity.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace pacman::logic {
+
+/**
+ * @brief Uniform grid that narrows the pairwise collision and overlap tests down to nearby entities.
+ *
+ * Each included entity is registered in every cell its closed bounds touch, so two rectangles that overlap always
+ * share a cell. forEachPair() visits candidate pairs (i, j), i < j, in the same order as a nested loop over the
+ * entity list would, which keeps lastCollisions()/lastOverlaps() identical to the brute-force scan. The cell table
+ * is stored compactly (one index array plus cell offsets) and reused between ticks, so rebuilding it does not
+ * allocate once the buffers have grown to the level's size.
+ */
+class BroadPhase {
+public:
+    /**
+     * @brief Sets the grid geometry, typically one cell per map tile.
+     * @param originX World-space X of the grid's left edge.
+     * @param originY World-space Y of the grid's bottom edge.
+     * @param cellSize Edge length of a cell (must be > 0).
+     * @param cols Number of columns (at least 1).
+     * @param rows Number of rows (at least 1).
+     */
+    void setGrid(float originX, float originY, float cellSize, int cols, int rows);
+
+    /**
+     * @brief Registers the entities accepted by the filter in the grid; null entries are skipped.
+     * @param entities Entity list; indices refer to this list.
+     * @param include Filter deciding which entities take part.
+     */
+    void build(const std::vector<std::shared_ptr<Entity>>& entities, bool (*include)(const Entity&));
+
+    /**
+     * @brief Calls visit(i) once for every registered entity sharing a cell with the closed rectangle, ascending.
+     *
+     * Every registered entity whose bounds overlap r is visited; callers still run the exact test.
+     *
+     * @param r World-space query rectangle.
+     * @param visit Callback taking an entity index.
+     */
+    template <typename Visit> void forEachNear(const Rect& r, Visit&& visit) {
+        candidates_.clear();
+
+        const CellRange range = cellsOf(r);
+        for (int y = range.y0; y <= range.y1; ++y) {
+            for (int x = range.x0; x <= range.x1; ++x) {
+                const std::size_t cell = static_cast<std::size_t>(y) * cols_ + static_cast<std::size_t>(x);
+                candidates_.insert(candidates_.end(), items_.begin() + cellStart_[cell],
+                                   items_.begin() + cellStart_[cell + 1]);
+            }
+        }
+
+        std::sort(candidates_.begin(), candidates_.end());
+        candidates_.erase(std::unique(candidates_.begin(), candidates_.end()), candidates_.end());
+
+        for (const std::uint32_t i : candidates_) {
+            visit(static_cast<std::size_t>(i));
+        }
+    }
+
+    /**
+     * @brief Calls visit(i, j) for every pair of registered entities that share a cell, i < j, ordered by i then j.
+     * @param visit Callback taking two entity indices.
+     */
+    template <typename Visit> void forEachPair(Visit&& visit) {
+        for (const std::uint32_t i : members_) {
+            candidates_.clear();
+
+            const CellRange range = ranges_[i];
+            for (int y = range.y0; y <= range.y1; ++y) {
+                for (int x = range.x0; x <= range.x1; ++x) {
+                    const std::size_t cell = static_cast<std::size_t>(y) * cols_ + static_cast<std::size_t>(x);
+                    const auto first = items_.begin() + cellStart_[cell];
+                    const auto last = items_.begin() + cellStart_[cell + 1];
+                    // Cells list their entities in ascending order, so everything after i is a candidate.
+                    candidates_.insert(candidates_.end(), std::upper_bound(first, last, i), last);
+                }
+            }
+
+            std::sort(candidates_.begin(), candidates_.end());
+            candidates_.erase(std::unique(candidates_.begin(), candidates_.end()), candidates_.end());
+
+            for (const std::uint32_t j : candidates_) {
+                visit(static_cast<std::size_t>(i), static_cast<std::size_t>(j));
+            }
+        }
+    }
+
+private:
+    /**
+     * @brief Inclusive range of cells covered by an entity.
+     */
+    struct CellRange {
+        int x0{0};
+        int y0{0};
+        int x1{0};
+        int y1{0};
+    };
+
+    /**
+     * @brief Returns the cells covered by the closed rectangle, clamped to the grid.
+     * @param r World-space rectangle.
+     * @return Inclusive cell range.
+     */
+    CellRange cellsOf(const Rect& r) const noexcept;
+
+    float originX_{-1.0f};
+    float originY_{-1.0f};
+    float cellSize_{2.0f};
+    int cols_{1};
+    int rows_{1};
+
+    std::vector<CellRange> ranges_;         ///< Cell range per entity index (valid for members_ only)
+    std::vector<std::uint32_t> members_;    ///< Registered entity indices, ascending
+    std::vector<std::uint32_t> cellStart_;  ///< Offset of each cell's entries in items_ (cells + 1 entries)
+    std::vector<std::uint32_t> items_;      ///< Entity indices grouped by cell, ascending within a cell
+    std::vector<std::uint32_t> cursor_;     ///< Write position per cell while building
+    std::vector<std::uint32_t> candidates_; ///< Scratch list for forEachPair() and forEachNear()
+};
+
+} // namespace pacman::logic
@@ -0,0 +1,39 @@
+#pragma once
+
+#include "SimStats.h"
+#include "WorldState.h"
+
+#include <cstdint>
+#include <type_traits>
+
+namespace pacman::logic {
+
+/**
+ * @brief Immutable image of everything needed to draw one simulation step.
+ *
+ * Published by the simulation thread after every step and applied to a render-side copy of the world by the
+ * render thread. Unlike WorldState it carries no timers or RNG state (it cannot resume a simulation), but it
+ * includes the score and the actors' bounds before the step for interpolation.
+ */
+struct RenderSnapshot {
+    std::uint64_t tick{0};        ///< World tick after the step
+    std::int64_t publishedNs{0};  ///< steady_clock time the snapshot was published, in nanoseconds
+    std::uint32_t entityCount{0}; ///< Entity count of the source world (layout check)
+    std::int32_t currentLevel{1};
+    std::int32_t lives{3};
+    std::int32_t score{0};
+    std::uint32_t turnedInput{0}; ///< LatencyTracker id of the last key press that turned Pac-Man (0 if none)
+
+    std::uint8_t fearActive{0};
+    std::uint8_t actorCount{0};
+
+    ActorState actors[WorldState::MaxActors]{};
+    Rect previousBounds[WorldState::MaxActors]{};         ///< Actor bounds before the step
+    std::uint64_t pickups[WorldState::MaxPickups / 64]{}; ///< One bit per pickup, set while still active
+
+    SimStats stats{}; ///< Work counters of the source world after the step
+};
+
+static_assert(std::is_trivially_copyable_v<RenderSnapshot>, "RenderSnapshot is copied between threads");
+
+} // namespace pacman::logic
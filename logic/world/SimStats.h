@@ -0,0 +1,50 @@
+#pragma once
+
+#include "../observer/Event.h"
+
+#include <cstdint>
+#include <type_traits>
+
+namespace pacman::logic {
+
+/**
+ * @brief Counters describing how much work the simulation did, owned by a World and reported by World::stats().
+ *
+ * Plain integers: a world is only updated by one thread at a time, and other threads get a copy through the
+ * RenderSnapshot. Counters grow monotonically until World::resetStats(); callers compare two copies to get rates.
+ * All counting statements are wrapped in PACMAN_SIM_STAT and disappear in release-lite builds
+ * (PACMAN_SIM_STATS=OFF), where every counter stays zero.
+ */
+struct SimStats {
+    std::uint64_t ticks{0};                 ///< World::update calls
+    std::uint64_t pairTests{0};             ///< AABB tests of broad-phase candidates in updateCollisions/Overlaps
+    std::uint64_t overlapsResolved{0};      ///< Overlap pairs handled by resolveOverlaps
+    std::uint64_t moveViabilityChecks{0};   ///< Ghost::isMoveViable calls
+    std::uint64_t ghostDecisions{0};        ///< Ghost direction choices evaluated
+    std::uint64_t ghostDecisionsSkipped{0}; ///< Choices skipped because the ghost is in a corridor
+    std::uint64_t events[EventTypeCount]{}; ///< Events dispatched by Subject::notify, per EventType
+    std::uint32_t activeEntities{0};        ///< Active entities in the last update
+
+    /**
+     * @brief Returns whether the counters are compiled in.
+     * @return False in release-lite builds.
+     */
+    static constexpr bool enabled() noexcept {
+#if defined(PACMAN_SIM_STATS)
+        return true;
+#else
+        return false;
+#endif
+    }
+};
+
+static_assert(std::is_trivially_copyable_v<SimStats>, "SimStats is copied into render snapshots");
+
+} // namespace pacman::logic
+
+#if defined(PACMAN_SIM_STATS)
+/// Keeps a statement that only maintains SimStats; compiled out in release-lite builds.
+#define PACMAN_SIM_STAT(...) __VA_ARGS__
+#else
+#define PACMAN_SIM_STAT(...) static_cast<void>(0)
+#endif
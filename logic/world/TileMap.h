@@ -2,7 +2,9 @@
 
 #include "../entities/Entity.h"
 #include <algorithm>
+#include <cstddef>
 #include <cstdint>
+#include <string>
 #include <vector>
 
 namespace pacman::logic {
@@ -23,27 +25,46 @@ enum class TileType : std::uint8_t {
 /**
  * @brief Logical tile map describing the level layout.
  *
- * The tile map is defined by a fixed ASCII layout that is converted
+ * The tile map is defined by an ASCII layout (the built-in level or caller-supplied rows) that is converted
  * into a 2D grid stored internally as a 1D array.
  * Tile coordinates are mapped to world-space rectangles in the range [-1, 1].
  */
 class TileMap {
 public:
-    static constexpr int Width = 20;  ///< Logical width of the grid in tiles
-    static constexpr int Height = 11; ///< Logical height of the grid in tiles
+    static constexpr int DefaultWidth = 20;  ///< Width of the built-in layout in tiles
+    static constexpr int DefaultHeight = 11; ///< Height of the built-in layout in tiles
 
     /**
      * @brief Constructs the tile map from the built-in ASCII layout.
      */
     TileMap();
 
+    /**
+     * @brief Constructs the tile map from ASCII rows using the same characters as the built-in layout.
+     *
+     * The width is taken from the first row; shorter rows are padded with empty tiles.
+     *
+     * @param rows Layout rows from top to bottom.
+     */
+    explicit TileMap(const std::vector<std::string>& rows);
+
+    /**
+     * @brief Returns the width of the grid in tiles.
+     */
+    int width() const noexcept { return width_; }
+
+    /**
+     * @brief Returns the height of the grid in tiles.
+     */
+    int height() const noexcept { return height_; }
+
     /**
      * @brief Checks whether the given tile coordinates are within map bounds.
      * @param x Tile X coordinate.
      * @param y Tile Y coordinate.
      * @return True if the coordinates are inside the map.
      */
-    bool inBounds(int x, int y) const noexcept { return x >= 0 && x < Width && y >= 0 && y < Height; }
+    bool inBounds(int x, int y) const noexcept { return x >= 0 && x < width_ && y >= 0 && y < height_; }
 
     /**
      * @brief Returns the tile type at the given coordinates.
@@ -55,7 +76,7 @@ public:
         if (!inBounds(x, y)) {
             return TileType::Empty;
         }
-        return tiles_[y * Width + x];
+        return tiles_[y * width_ + x];
     }
 
     /**
@@ -71,10 +92,10 @@ public:
     Rect tileRect(int x, int y) const noexcept {
         Rect r{};
 
-        const float tileSize = 2.0f / static_cast<float>(std::max(Width, Height));
+        const float tileSize = 2.0f / static_cast<float>(std::max(width_, height_));
 
-        const float worldW = tileSize * static_cast<float>(Width);
-        const float worldH = tileSize * static_cast<float>(Height);
+        const float worldW = tileSize * static_cast<float>(width_);
+        const float worldH = tileSize * static_cast<float>(height_);
 
         const float startX = -worldW * 0.5f;
         const float startY = worldH * 0.5f;
@@ -88,12 +109,41 @@ public:
     }
 
 private:
+    /**
+     * @brief Maps a layout character to its tile type.
+     * @param c Layout character.
+     * @return Tile type, Empty for unknown characters.
+     */
+    static TileType tileFromChar(char c) noexcept;
+
+    int width_{0};                ///< Width of the grid in tiles
+    int height_{0};               ///< Height of the grid in tiles
     std::vector<TileType> tiles_; ///< Flattened 2D grid stored row-major
 };
 
 /**
- * @brief Constructs the tile map using a fixed ASCII layout.
- *
+ * @brief Constructs the tile map using the built-in ASCII layout.
+ */
+inline TileMap::TileMap()
+    : TileMap(std::vector<std::string>{"####################", "#....#........#...F#", "#.##.#.######.#.##.#",
+                                       "#.#..............#.#", "#.#.##.######.##.#.#", "#.P....# G  #......#",
+                                       "#.#.##.##DD##.##.#.#", "#.#..............#.#", "#.##.#.######.#.##.#",
+                                       "#F...#........#....#", "####################"}) {}
+
+inline TileMap::TileMap(const std::vector<std::string>& rows)
+    : width_(rows.empty() ? 0 : static_cast<int>(rows.front().size())), height_(static_cast<int>(rows.size())),
+      tiles_(static_cast<std::size_t>(width_) * static_cast<std::size_t>(height_), TileType::Empty) {
+
+    for (int y = 0; y < height_; ++y) {
+        const std::string& row = rows[static_cast<std::size_t>(y)];
+        const int count = std::min(width_, static_cast<int>(row.size()));
+        for (int x = 0; x < count; ++x) {
+            tiles_[y * width_ + x] = tileFromChar(row[static_cast<std::size_t>(x)]);
+        }
+    }
+}
+
+/**
  * Characters in the layout map to tile types:
  * - '#' → Wall
  * - '.' → Coin
@@ -102,45 +152,23 @@ private:
  * - 'G' → Ghost spawn
  * - 'D' → Ghost gate
  */
-inline TileMap::TileMap() : tiles_(Width * Height, TileType::Empty) {
-
-    static const char* layout[Height] = {"####################", "#....#........#...F#", "#.##.#.######.#.##.#",
-                                         "#.#..............#.#", "#.#.##.######.##.#.#", "#.P....# G  #......#",
-                                         "#.#.##.##DD##.##.#.#", "#.#..............#.#", "#.##.#.######.#.##.#",
-                                         "#F...#........#....#", "####################"};
-
-    for (int y = 0; y < Height; ++y) {
-        for (int x = 0; x < Width; ++x) {
-            const char c = layout[y][x];
-            TileType type = TileType::Empty;
-
-            switch (c) {
-            case '#':
-                type = TileType::Wall;
-                break;
-            case '.':
-                type = TileType::Coin;
-                break;
-            case 'F':
-                type = TileType::Fruit;
-                break;
-            case 'P':
-                type = TileType::PacManSpawn;
-                break;
-            case 'G':
-                type = TileType::GhostSpawn;
-                break;
-            case 'D':
-                type = TileType::GhostGate;
-                break;
-            default:
-                type = TileType::Empty;
-                break;
-            }
-
-            tiles_[y * Width + x] = type;
-        }
+inline TileType TileMap::tileFromChar(char c) noexcept {
+    switch (c) {
+    case '#':
+        return TileType::Wall;
+    case '.':
+        return TileType::Coin;
+    case 'F':
+        return TileType::Fruit;
+    case 'P':
+        return TileType::PacManSpawn;
+    case 'G':
+        return TileType::GhostSpawn;
+    case 'D':
+        return TileType::GhostGate;
+    default:
+        return TileType::Empty;
     }
 }
 
-} // namespace pacman::logic
\ No newline at end of file
+} // namespace pacman::logic
@@ -6,11 +6,14 @@
 #include "../entities/PacMan.h"
 #include "../entities/Wall.h"
 
-#include "../utils/Stopwatch.h"
+#include "../utils/AllocationCounter.h"
+#include "../utils/Profiler.h"
+#include "../utils/Random.h"
+#include "../utils/TraceRecorder.h"
 
 #include <algorithm>
-#include <chrono>
 #include <limits>
+#include <utility>
 #include <vector>
 
 namespace pacman::logic {
@@ -30,9 +33,14 @@ World::EntityId World::addEntity(EntityPtr e) {
     if (auto ghost = std::dynamic_pointer_cast<Ghost>(e)) {
         ghost->setWorld(this);
     }
+    if (auto* subject = dynamic_cast<Subject*>(e.get())) {
+        subject->setStats(&stats_);
+    }
 
     const EntityId id = e->id();
     entities_.push_back(std::move(e));
+    stateSlotsValid_ = false;
+    wallGridValid_ = false;
     return id;
 }
 
@@ -47,6 +55,8 @@ bool World::removeEntity(EntityId id) {
 
     const bool removed = (it != entities_.end());
     entities_.erase(it, entities_.end());
+    stateSlotsValid_ = false;
+    wallGridValid_ = false;
     return removed;
 }
 
@@ -55,21 +65,25 @@ bool World::removeEntity(EntityId id) {
  * @param id Entity ID.
  * @return Pointer to entity or nullptr if not found.
  */
-Entity* World::get(EntityId id) {
-    for (auto& p : entities_) {
-        if (p && p->id() == id) {
-            return p.get();
-        }
-    }
-    return nullptr;
-}
+Entity* World::get(EntityId id) { return const_cast<Entity*>(std::as_const(*this).get(id)); }
 
 /**
  * @brief Returns a read-only entity pointer by ID.
+ *
+ * IDs are handed out in insertion order starting at 1, so unless entities were removed the entity sits at index
+ * id - 1; the linear scan only runs when that slot holds a different entity.
+ *
  * @param id Entity ID.
  * @return Pointer to entity or nullptr if not found.
  */
 const Entity* World::get(EntityId id) const {
+    if (id >= 1 && id <= entities_.size()) {
+        const auto& p = entities_[id - 1];
+        if (p && p->id() == id) {
+            return p.get();
+        }
+    }
+
     for (auto& p : entities_) {
         if (p && p->id() == id) {
             return p.get();
@@ -80,27 +94,77 @@ const Entity* World::get(EntityId id) const {
 
 /**
  * @brief Updates world simulation: entities, collisions, overlaps, timers, and releases.
+ *
+ * Each phase is timed separately when the profiler is compiled in (PACMAN_PROFILE) and traced as its own span. With
+ * PACMAN_ALLOC_TRACKING the heap allocations of the whole update and of each phase are counted as well.
+ *
  * @param dt Time step in seconds.
  */
 void World::update(double dt) {
-    updateGhostRelease();
-
-    handlePacManTurning(dt);
-    updateEntities(dt);
+    PACMAN_ALLOC_SCOPE("world.update");
 
-    updateCollisions();
-    resolveCollisions();
+    ++tick_;
+    simTime_ += dt;
+    PACMAN_SIM_STAT(++stats_.ticks);
 
-    updateOverlaps();
-    resolveOverlaps();
+    storeActorPreviousBounds();
 
-    updateFearTimer(dt);
+    {
+        PACMAN_PROFILE_SCOPE(ProfilePhase::Release);
+        PACMAN_TRACE_SCOPE("world", "release");
+        PACMAN_ALLOC_SCOPE("world.release");
+        updateGhostRelease();
+    }
+    {
+        PACMAN_PROFILE_SCOPE(ProfilePhase::Turning);
+        PACMAN_TRACE_SCOPE("world", "turning");
+        PACMAN_ALLOC_SCOPE("world.turning");
+        handlePacManTurning(dt);
+    }
+    {
+        PACMAN_PROFILE_SCOPE(ProfilePhase::Entities);
+        PACMAN_TRACE_SCOPE("world", "entities");
+        PACMAN_ALLOC_SCOPE("world.entities");
+        updateEntities(dt);
+    }
+    {
+        PACMAN_PROFILE_SCOPE(ProfilePhase::Collisions);
+        PACMAN_TRACE_SCOPE("world", "collisions");
+        PACMAN_ALLOC_SCOPE("world.collisions");
+        updateCollisions();
+    }
+    {
+        PACMAN_PROFILE_SCOPE(ProfilePhase::ResolveCollisions);
+        PACMAN_TRACE_SCOPE("world", "resolveCollisions");
+        PACMAN_ALLOC_SCOPE("world.resolveCollisions");
+        resolveCollisions();
+    }
+    {
+        PACMAN_PROFILE_SCOPE(ProfilePhase::Overlaps);
+        PACMAN_TRACE_SCOPE("world", "overlaps");
+        PACMAN_ALLOC_SCOPE("world.overlaps");
+        updateOverlaps();
+    }
+    {
+        PACMAN_PROFILE_SCOPE(ProfilePhase::ResolveOverlaps);
+        PACMAN_TRACE_SCOPE("world", "resolveOverlaps");
+        PACMAN_ALLOC_SCOPE("world.resolveOverlaps");
+        resolveOverlaps();
+    }
+    {
+        PACMAN_PROFILE_SCOPE(ProfilePhase::Fear);
+        PACMAN_TRACE_SCOPE("world", "fear");
+        PACMAN_ALLOC_SCOPE("world.fear");
+        updateFearTimer(dt);
+    }
 }
 
 /**
  * @brief Ticks entities with dt=0.0 to allow animations without moving simulation forward.
  */
 void World::tickAnimationsOnly() {
+    storeActorPreviousBounds();
+
     for (auto& e : entities_) {
         if (e && e->active) {
             e->update(0.0);
@@ -132,11 +196,14 @@ void World::handlePacManTurning(double dt) {
  * @param dt Time step in seconds.
  */
 void World::updateEntities(double dt) {
+    PACMAN_SIM_STAT(std::uint32_t active = 0);
     for (auto& e : entities_) {
         if (e && e->active) {
             e->update(dt);
+            PACMAN_SIM_STAT(++active);
         }
     }
+    PACMAN_SIM_STAT(stats_.activeEntities = active);
 }
 
 /**
@@ -163,27 +230,16 @@ void World::setPacManDirection(Direction dir) {
 void World::updateCollisions() {
     lastCollisions_.clear();
 
-    const std::size_t n = entities_.size();
-    for (std::size_t i = 0; i < n; ++i) {
+    broadPhase_.build(entities_, [](const Entity& e) { return e.active && e.solid; });
+    broadPhase_.forEachPair([this](std::size_t i, std::size_t j) {
         const auto& a = entities_[i];
-        if (!a || !a->active || !a->solid) {
-            continue;
-        }
-
-        const Rect ra = a->bounds();
+        const auto& b = entities_[j];
 
-        for (std::size_t j = i + 1; j < n; ++j) {
-            const auto& b = entities_[j];
-            if (!b || !b->active || !b->solid) {
-                continue;
-            }
-
-            const Rect rb = b->bounds();
-            if (intersects(ra, rb)) {
-                lastCollisions_.emplace_back(a->id(), b->id());
-            }
+        PACMAN_SIM_STAT(++stats_.pairTests);
+        if (intersects(a->bounds(), b->bounds())) {
+            lastCollisions_.emplace_back(a->id(), b->id());
         }
-    }
+    });
 }
 
 /**
@@ -193,32 +249,23 @@ void World::updateCollisions() {
 void World::updateOverlaps(float minOverlapRatio) {
     lastOverlaps_.clear();
 
-    const std::size_t n = entities_.size();
-    for (std::size_t i = 0; i < n; ++i) {
+    broadPhase_.build(entities_, [](const Entity& e) { return e.active; });
+    broadPhase_.forEachPair([this, minOverlapRatio](std::size_t i, std::size_t j) {
         const auto& a = entities_[i];
-        if (!a || !a->active) {
-            continue;
-        }
+        const auto& b = entities_[j];
 
+        PACMAN_SIM_STAT(++stats_.pairTests);
         const Rect ra = a->bounds();
+        const Rect rb = b->bounds();
+        if (!intersects(ra, rb)) {
+            return;
+        }
 
-        for (std::size_t j = i + 1; j < n; ++j) {
-            const auto& b = entities_[j];
-            if (!b || !b->active) {
-                continue;
-            }
-
-            const Rect rb = b->bounds();
-            if (!intersects(ra, rb)) {
-                continue;
-            }
-
-            const float ratio = overlapRatio(ra, rb);
-            if (ratio >= minOverlapRatio) {
-                lastOverlaps_.emplace_back(a->id(), b->id());
-            }
+        const float ratio = overlapRatio(ra, rb);
+        if (ratio >= minOverlapRatio) {
+            lastOverlaps_.emplace_back(a->id(), b->id());
         }
-    }
+    });
 }
 
 /**
@@ -284,6 +331,7 @@ void World::resolveOverlaps() {
         if (!a || !b) {
             continue;
         }
+        PACMAN_SIM_STAT(++stats_.overlapsResolved);
 
         {
             PacMan* pac = dynamic_cast<PacMan*>(a);
@@ -429,24 +477,9 @@ bool World::checkPacmanDesiredDirection(PacMan& pac, double dt) {
     next.x += dirToDx(desired) * step;
     next.y += dirToDy(desired) * step;
 
-    for (const auto& ent : entities_) {
-        if (!ent || !ent->active || !ent->solid) {
-            continue;
-        }
-        if (ent.get() == &pac) {
-            continue;
-        }
-
-        auto* wall = dynamic_cast<Wall*>(ent.get());
-        if (!wall) {
-            continue;
-        }
-
-        const double factor = static_cast<float>(1.0 + 0.05 * (currentLevel_ - 1));
-
-        if (intersects(next, wall->bounds(), 0.0003f * factor)) {
-            return false;
-        }
+    const double factor = static_cast<float>(1.0 + 0.05 * (currentLevel_ - 1));
+    if (wallBlocks(next, static_cast<float>(0.0003f * factor))) {
+        return false;
     }
 
     pac.setDirection(desired);
@@ -463,6 +496,8 @@ void World::snapshotLevelTemplate() { levelTemplate_ = entities_; }
  */
 void World::resetLevel() {
     entities_.clear();
+    stateSlotsValid_ = false;
+    wallGridValid_ = false;
     nextId_ = 1;
     lastCollisions_.clear();
 }
@@ -502,9 +537,18 @@ void World::applyLevelSpeedBoost() {
  * @param map Tile map describing the level.
  */
 void World::loadLevel(const pacman::logic::TileMap& map) {
+    PACMAN_TRACE_SCOPE("world", "loadLevel");
+
     tileMap_ = map;
+    if (tileMap_.height() > 0) {
+        const Rect origin = tileMap_.tileRect(0, tileMap_.height() - 1);
+        broadPhase_.setGrid(origin.x, origin.y, origin.w, tileMap_.width(), tileMap_.height());
+        wallGrid_.setGrid(origin.x, origin.y, origin.w, tileMap_.width(), tileMap_.height());
+    }
 
     entities_.clear();
+    stateSlotsValid_ = false;
+    wallGridValid_ = false;
     lastCollisions_.clear();
     nextId_ = 1;
 
@@ -516,8 +560,8 @@ void World::loadLevel(const pacman::logic::TileMap& map) {
         return;
     }
 
-    for (int y = 0; y < TileMap::Height; ++y) {
-        for (int x = 0; x < TileMap::Width; ++x) {
+    for (int y = 0; y < tileMap_.height(); ++y) {
+        for (int x = 0; x < tileMap_.width(); ++x) {
             const TileType t = tileMap_.at(x, y);
             const Rect r = tileMap_.tileRect(x, y);
 
@@ -628,6 +672,7 @@ void World::loadLevel(const pacman::logic::TileMap& map) {
     startGhostReleaseClocks();
     snapshotLevelTemplate();
     startDelay(1.0);
+    storeActorPreviousBounds();
 }
 
 /**
@@ -660,6 +705,36 @@ bool World::canGhostPassGate(const Ghost* g) const noexcept {
     return false;
 }
 
+/**
+ * @brief Returns whether a rectangle intersects any active solid wall.
+ * @param r World-space rectangle.
+ * @param eps Tolerance passed to intersects().
+ * @param ghost Ghost asking, or nullptr; the gate is ignored while it may pass.
+ * @return True if a wall blocks the rectangle.
+ */
+bool World::wallBlocks(const Rect& r, float eps, const Ghost* ghost) const {
+    if (!wallGridValid_) {
+        wallGrid_.build(entities_, [](const Entity& e) {
+            return e.active && e.solid && dynamic_cast<const Wall*>(&e) != nullptr;
+        });
+        wallGridValid_ = true;
+    }
+
+    const Wall* gate = ghost ? ghostGate() : nullptr;
+    bool blocked = false;
+    wallGrid_.forEachNear(r, [&](std::size_t i) {
+        const Entity* wall = entities_[i].get();
+        if (blocked || !wall->active || !wall->solid) {
+            return;
+        }
+        if (wall == gate && canGhostPassGate(ghost)) {
+            return;
+        }
+        blocked = intersects(r, wall->bounds(), eps);
+    });
+    return blocked;
+}
+
 /**
  * @brief Enables fear mode for all ghosts and resets the fear timer.
  */
@@ -721,7 +796,7 @@ void World::updateFearTimer(double dt) {
  * @brief Initializes ghost release timers for a fresh level start.
  */
 void World::startGhostReleaseClocks() {
-    levelStartTime_ = Stopwatch::getInstance().elapsed();
+    levelStartTime_ = simTime_;
     nextGhostToRelease_ = 0;
     gatePass_.clear();
 }
@@ -756,8 +831,7 @@ void World::updateGhostRelease() {
         return;
     }
 
-    const double now = Stopwatch::getInstance().elapsed();
-    const double elapsed = now - levelStartTime_;
+    const double elapsed = simTime_ - levelStartTime_;
 
     while (nextGhostToRelease_ < ghostReleaseQueue_.size()) {
         const double delay =
@@ -780,4 +854,336 @@ void World::updateGhostRelease() {
     }
 }
 
+/**
+ * @brief Rebuilds the cached entity indices used by saveState()/restoreState() if the layout changed.
+ */
+void World::buildStateSlots() const {
+    if (stateSlotsValid_) {
+        return;
+    }
+
+    actorSlots_.clear();
+    pickupSlots_.clear();
+
+    for (std::size_t i = 0; i < entities_.size(); ++i) {
+        const Entity* e = entities_[i].get();
+        if (!e) {
+            continue;
+        }
+
+        if (dynamic_cast<const PacMan*>(e)) {
+            actorSlots_.push_back(ActorSlot{i, false});
+        } else if (dynamic_cast<const Ghost*>(e)) {
+            actorSlots_.push_back(ActorSlot{i, true});
+        } else if (dynamic_cast<const Coin*>(e) || dynamic_cast<const Fruit*>(e)) {
+            pickupSlots_.push_back(i);
+        }
+    }
+
+    stateSlotsValid_ = true;
+}
+
+/**
+ * @brief Records the current bounds of all actors as the start of the next step.
+ *
+ * Called before every update and after anything that places actors without moving them (level load, state
+ * restore, animation-only ticks), so views never interpolate across a jump.
+ */
+void World::storeActorPreviousBounds() {
+    buildStateSlots();
+    for (const auto& slot : actorSlots_) {
+        Entity* e = entities_[slot.index].get();
+        if (slot.ghost) {
+            static_cast<Ghost*>(e)->storePreviousBounds();
+        } else {
+            static_cast<PacMan*>(e)->storePreviousBounds();
+        }
+    }
+}
+
+/**
+ * @brief Returns the Pac-Man entity of the loaded level, using the cached actor slots.
+ * @return Pointer to Pac-Man, or nullptr if the level has none.
+ */
+const PacMan* World::pacMan() const {
+    buildStateSlots();
+    for (const auto& slot : actorSlots_) {
+        if (!slot.ghost) {
+            return static_cast<const PacMan*>(entities_[slot.index].get());
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Copies all mutable simulation state into a flat snapshot.
+ *
+ * Actors and pickups are stored in entity order; gate passes refer to actor slots instead of pointers.
+ * Unused slots are zeroed so equal simulation states produce equal bytes.
+ *
+ * @param out Snapshot to fill.
+ * @return False if the level has more actors or pickups than a WorldState can hold.
+ */
+bool World::saveState(WorldState& out) const {
+    buildStateSlots();
+    if (actorSlots_.size() > WorldState::MaxActors || pickupSlots_.size() > WorldState::MaxPickups) {
+        return false;
+    }
+
+    out.entityCount = static_cast<std::uint32_t>(entities_.size());
+    out.tick = tick_;
+    out.currentLevel = currentLevel_;
+    out.lives = lives_;
+
+    out.simTime = simTime_;
+    out.levelStartTime = levelStartTime_;
+    out.fearTimer = fearTimer_;
+    out.fearDuration = fearDuration_;
+    out.startDelayTimer = startDelayTimer_;
+
+    out.fearActive = fearActive_ ? 1 : 0;
+    out.nextGhostToRelease = static_cast<std::uint8_t>(nextGhostToRelease_);
+
+    out.actorCount = static_cast<std::uint8_t>(actorSlots_.size());
+    for (std::size_t i = 0; i < actorSlots_.size(); ++i) {
+        const Entity* e = entities_[actorSlots_[i].index].get();
+        ActorState& a = out.actors[i];
+
+        if (actorSlots_[i].ghost) {
+            const auto* ghost = static_cast<const Ghost*>(e);
+            a.bounds = ghost->bounds();
+            a.speed = ghost->speed();
+            a.direction = static_cast<std::uint8_t>(ghost->direction());
+            a.desiredDirection = 0;
+            a.mode = static_cast<std::uint8_t>(ghost->mode());
+        } else {
+            const auto* pac = static_cast<const PacMan*>(e);
+            a.bounds = pac->bounds();
+            a.speed = pac->speed();
+            a.direction = static_cast<std::uint8_t>(pac->direction());
+            a.desiredDirection = static_cast<std::uint8_t>(pac->desiredDirection());
+            a.mode = 0;
+        }
+        a.active = e->active ? 1 : 0;
+    }
+    for (std::size_t i = actorSlots_.size(); i < WorldState::MaxActors; ++i) {
+        out.actors[i] = ActorState{};
+    }
+
+    for (auto& word : out.pickups) {
+        word = 0;
+    }
+    for (std::size_t i = 0; i < pickupSlots_.size(); ++i) {
+        if (entities_[pickupSlots_[i]]->active) {
+            out.pickups[i / 64] |= std::uint64_t{1} << (i % 64);
+        }
+    }
+
+    std::size_t passes = 0;
+    for (const auto& p : gatePass_) {
+        for (std::size_t i = 0; i < actorSlots_.size() && passes < WorldState::MaxActors; ++i) {
+            if (p.ghost && entities_[actorSlots_[i].index].get() == p.ghost.get()) {
+                out.gatePass[passes].actor = static_cast<std::uint8_t>(i);
+                out.gatePass[passes].touchedGate = p.touchedGate ? 1 : 0;
+                ++passes;
+                break;
+            }
+        }
+    }
+    out.gatePassCount = static_cast<std::uint8_t>(passes);
+    for (std::size_t i = passes; i < WorldState::MaxActors; ++i) {
+        out.gatePass[i] = GatePassState{};
+    }
+
+    out.rng = Random::getInstance().engineState();
+    return true;
+}
+
+/**
+ * @brief Restores mutable simulation state from a snapshot of the same level layout.
+ *
+ * Actors are restored without side effects (no fear reversal, no speed changes) and re-announce their
+ * position, direction and mode to observers so views stay in sync.
+ *
+ * @param state Snapshot produced by saveState().
+ * @return False if the snapshot does not match the currently loaded entities.
+ */
+bool World::restoreState(const WorldState& state) {
+    buildStateSlots();
+    if (state.entityCount != entities_.size() || state.actorCount != actorSlots_.size()) {
+        return false;
+    }
+
+    tick_ = state.tick;
+    currentLevel_ = state.currentLevel;
+    lives_ = state.lives;
+
+    simTime_ = state.simTime;
+    levelStartTime_ = state.levelStartTime;
+    fearTimer_ = state.fearTimer;
+    fearDuration_ = state.fearDuration;
+    startDelayTimer_ = state.startDelayTimer;
+
+    fearActive_ = state.fearActive != 0;
+    nextGhostToRelease_ = state.nextGhostToRelease;
+
+    for (std::size_t i = 0; i < actorSlots_.size(); ++i) {
+        Entity* e = entities_[actorSlots_[i].index].get();
+        const ActorState& a = state.actors[i];
+        e->active = a.active != 0;
+
+        if (actorSlots_[i].ghost) {
+            static_cast<Ghost*>(e)->restore(a.bounds, static_cast<Direction>(a.direction),
+                                            static_cast<GhostMode>(a.mode), a.speed);
+        } else {
+            static_cast<PacMan*>(e)->restore(a.bounds, static_cast<Direction>(a.direction),
+                                             static_cast<Direction>(a.desiredDirection), a.speed);
+        }
+    }
+
+    for (std::size_t i = 0; i < pickupSlots_.size(); ++i) {
+        entities_[pickupSlots_[i]]->active = (state.pickups[i / 64] >> (i % 64)) & 1u;
+    }
+
+    gatePass_.clear();
+    for (std::size_t i = 0; i < state.gatePassCount; ++i) {
+        const GatePassState& p = state.gatePass[i];
+        if (p.actor < actorSlots_.size() && actorSlots_[p.actor].ghost) {
+            auto ghost = std::static_pointer_cast<Ghost>(entities_[actorSlots_[p.actor].index]);
+            gatePass_.push_back(GatePass{std::move(ghost), p.touchedGate != 0});
+        }
+    }
+
+    lastCollisions_.clear();
+    lastOverlaps_.clear();
+    storeActorPreviousBounds();
+
+    Random::getInstance().setEngineState(state.rng);
+    return true;
+}
+
+/**
+ * @brief Copies what is needed to draw the current step into a render snapshot.
+ *
+ * Uses the same actor and pickup order as saveState(), plus the actors' previous bounds for interpolation.
+ * Unused slots are zeroed.
+ *
+ * @param out Snapshot to fill; score and publish time are left to the caller.
+ * @return False if the level has more actors or pickups than a RenderSnapshot can hold.
+ */
+bool World::captureRenderSnapshot(RenderSnapshot& out) const {
+    buildStateSlots();
+    if (actorSlots_.size() > WorldState::MaxActors || pickupSlots_.size() > WorldState::MaxPickups) {
+        return false;
+    }
+
+    out.tick = tick_;
+    out.entityCount = static_cast<std::uint32_t>(entities_.size());
+    out.currentLevel = currentLevel_;
+    out.lives = lives_;
+    out.fearActive = fearActive_ ? 1 : 0;
+    out.stats = stats_;
+
+    out.actorCount = static_cast<std::uint8_t>(actorSlots_.size());
+    for (std::size_t i = 0; i < actorSlots_.size(); ++i) {
+        const Entity* e = entities_[actorSlots_[i].index].get();
+        ActorState& a = out.actors[i];
+
+        if (actorSlots_[i].ghost) {
+            const auto* ghost = static_cast<const Ghost*>(e);
+            a.bounds = ghost->bounds();
+            a.speed = ghost->speed();
+            a.direction = static_cast<std::uint8_t>(ghost->direction());
+            a.desiredDirection = 0;
+            a.mode = static_cast<std::uint8_t>(ghost->mode());
+            out.previousBounds[i] = ghost->previousBounds();
+        } else {
+            const auto* pac = static_cast<const PacMan*>(e);
+            a.bounds = pac->bounds();
+            a.speed = pac->speed();
+            a.direction = static_cast<std::uint8_t>(pac->direction());
+            a.desiredDirection = static_cast<std::uint8_t>(pac->desiredDirection());
+            a.mode = 0;
+            out.previousBounds[i] = pac->previousBounds();
+        }
+        a.active = e->active ? 1 : 0;
+    }
+    for (std::size_t i = actorSlots_.size(); i < WorldState::MaxActors; ++i) {
+        out.actors[i] = ActorState{};
+        out.previousBounds[i] = Rect{};
+    }
+
+    for (auto& word : out.pickups) {
+        word = 0;
+    }
+    for (std::size_t i = 0; i < pickupSlots_.size(); ++i) {
+        if (entities_[pickupSlots_[i]]->active) {
+            out.pickups[i / 64] |= std::uint64_t{1} << (i % 64);
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @brief Mirrors a render snapshot into this world so its observers can draw it.
+ *
+ * Meant for a render-side copy of the simulated world that is never updated itself. Actors only announce a changed
+ * direction or mode, so a frame in which nothing changed state sends no events (and allocates nothing in
+ * Subject::notify()); pickups that disappeared are collected so their observers see a Collected event, and pickups
+ * that reappeared (rewind) are simply reactivated. Timers, gate passes and the RNG are not touched.
+ *
+ * @param snapshot Snapshot produced by captureRenderSnapshot().
+ * @return False if the snapshot does not match the currently loaded entities.
+ */
+bool World::applyRenderSnapshot(const RenderSnapshot& snapshot) {
+    buildStateSlots();
+    if (snapshot.entityCount != entities_.size() || snapshot.actorCount != actorSlots_.size()) {
+        return false;
+    }
+
+    tick_ = snapshot.tick;
+    currentLevel_ = snapshot.currentLevel;
+    lives_ = snapshot.lives;
+    fearActive_ = snapshot.fearActive != 0;
+
+    for (std::size_t i = 0; i < actorSlots_.size(); ++i) {
+        Entity* e = entities_[actorSlots_[i].index].get();
+        const ActorState& a = snapshot.actors[i];
+        e->active = a.active != 0;
+
+        if (actorSlots_[i].ghost) {
+            auto* ghost = static_cast<Ghost*>(e);
+            ghost->applySnapshot(a.bounds, static_cast<Direction>(a.direction), static_cast<GhostMode>(a.mode),
+                                 a.speed);
+            ghost->setPreviousBounds(snapshot.previousBounds[i]);
+        } else {
+            auto* pac = static_cast<PacMan*>(e);
+            pac->applySnapshot(a.bounds, static_cast<Direction>(a.direction),
+                               static_cast<Direction>(a.desiredDirection), a.speed);
+            pac->setPreviousBounds(snapshot.previousBounds[i]);
+        }
+    }
+
+    for (std::size_t i = 0; i < pickupSlots_.size(); ++i) {
+        Entity* e = entities_[pickupSlots_[i]].get();
+        const bool visible = (snapshot.pickups[i / 64] >> (i % 64)) & 1u;
+        if (visible == e->active) {
+            continue;
+        }
+
+        if (visible) {
+            e->active = true;
+        } else if (auto* coin = dynamic_cast<Coin*>(e)) {
+            coin->collect();
+        } else if (auto* fruit = dynamic_cast<Fruit*>(e)) {
+            fruit->collect();
+        }
+    }
+
+    // Events raised while mirroring count into stats_; the source world's counters replace them.
+    stats_ = snapshot.stats;
+    return true;
+}
+
 } // namespace pacman::logic
\ No newline at end of file
@@ -9,7 +9,11 @@
 #include "../entities/Direction.h"
 #include "../entities/Entity.h"
 #include "../factory/AbstractFactory.h"
+#include "BroadPhase.h"
+#include "RenderSnapshot.h"
+#include "SimStats.h"
 #include "TileMap.h"
+#include "WorldState.h"
 
 namespace pacman::logic {
 
@@ -92,6 +96,9 @@ inline float overlapRatio(const Rect& a, const Rect& b) {
  * - level loading and progression
  * - fear mode management
  * - ghost gate release system
+ * - flat snapshots of all mutable state (saveState/restoreState)
+ * - render snapshots for drawing on another thread (captureRenderSnapshot/applyRenderSnapshot)
+ * - work counters for diagnostics (stats)
  */
 class World {
 public:
@@ -196,6 +203,17 @@ public:
      */
     bool isGameOver() const noexcept { return lives_ <= 0; }
 
+    /**
+     * @brief Enables fear mode for all ghosts and resets the fear timer.
+     */
+    void startFearMode();
+
+    /**
+     * @brief Returns whether fear mode is currently active.
+     * @return True while ghosts are frightened.
+     */
+    bool isFearActive() const noexcept { return fearActive_; }
+
     /**
      * @brief Stores the current entity setup as a template for resets.
      */
@@ -238,6 +256,19 @@ public:
      */
     bool canGhostPassGate(const Ghost* g) const noexcept;
 
+    /**
+     * @brief Returns whether a rectangle intersects any active solid wall.
+     *
+     * Walls are looked up in a grid of the level's walls (rebuilt after entities are added or removed), so the cost
+     * does not grow with the size of the map.
+     *
+     * @param r World-space rectangle, typically an actor's bounds after a tentative step.
+     * @param eps Tolerance passed to intersects().
+     * @param ghost Ghost asking, or nullptr; the gate is ignored while canGhostPassGate(ghost) holds.
+     * @return True if a wall blocks the rectangle.
+     */
+    bool wallBlocks(const Rect& r, float eps, const Ghost* ghost = nullptr) const;
+
     /**
      * @brief Returns whether the level is cleared (no active coins or fruits).
      * @return True if cleared.
@@ -253,6 +284,63 @@ public:
         startDelayTimer_ = seconds;
     }
 
+    /**
+     * @brief Returns the number of simulation steps taken since construction.
+     * @return Tick counter.
+     */
+    std::uint64_t tick() const noexcept { return tick_; }
+
+    /**
+     * @brief Returns the simulated time in seconds accumulated by update().
+     * @return Simulation time.
+     */
+    double simTime() const noexcept { return simTime_; }
+
+    /**
+     * @brief Returns the work counters accumulated by update() (all zero in release-lite builds).
+     * @return Statistics since construction or the last resetStats().
+     */
+    const SimStats& stats() const noexcept { return stats_; }
+
+    /**
+     * @brief Zeroes the work counters.
+     */
+    void resetStats() noexcept { stats_ = SimStats{}; }
+
+    /**
+     * @brief Returns the Pac-Man entity of the loaded level.
+     * @return Pointer to Pac-Man, or nullptr if the level has none.
+     */
+    const PacMan* pacMan() const;
+
+    /**
+     * @brief Copies all mutable simulation state (actors, pickups, timers, lives, RNG) into a flat snapshot.
+     * @param out Snapshot to fill.
+     * @return False if the level has more actors or pickups than a WorldState can hold.
+     */
+    bool saveState(WorldState& out) const;
+
+    /**
+     * @brief Restores mutable simulation state from a snapshot of the same level layout.
+     * @param state Snapshot produced by saveState().
+     * @return False if the snapshot does not match the currently loaded entities.
+     */
+    bool restoreState(const WorldState& state);
+
+    /**
+     * @brief Copies what is needed to draw the current step (actors, pickups, lives, level) into a render snapshot.
+     * @param out Snapshot to fill; score and publish time are left to the caller.
+     * @return False if the level has more actors or pickups than a RenderSnapshot can hold.
+     */
+    bool captureRenderSnapshot(RenderSnapshot& out) const;
+
+    /**
+     * @brief Mirrors a render snapshot of the same level layout into this world so its observers can draw it.
+     * @param snapshot Snapshot produced by captureRenderSnapshot().
+     * @return False if the snapshot does not match the currently loaded entities.
+     */
+    bool applyRenderSnapshot(const RenderSnapshot& snapshot);
+
 private:
     /**
      * @brief Checks whether Pac-Man can turn into its desired direction this frame.
@@ -295,11 +383,6 @@ private:
      */
     void resolveOverlaps();
 
-    /**
-     * @brief Enables fear mode for all ghosts and resets the fear timer.
-     */
-    void startFearMode();
-
     /**
      * @brief Disables fear mode for all ghosts immediately.
      */
@@ -338,12 +421,23 @@ private:
      */
     void applyLevelSpeedBoost();
 
+    /**
+     * @brief Rebuilds the cached entity indices used by saveState()/restoreState() if the layout changed.
+     */
+    void buildStateSlots() const;
+
+    /**
+     * @brief Records the current bounds of all actors as the start of the next step (render interpolation).
+     */
+    void storeActorPreviousBounds();
+
 private:
     AbstractFactory* factory_{nullptr};
 
     std::vector<EntityPtr> entities_;
     std::vector<std::pair<EntityId, EntityId>> lastCollisions_;
     std::vector<std::pair<EntityId, EntityId>> lastOverlaps_;
+    BroadPhase broadPhase_; ///< Candidate pairs for updateCollisions() and updateOverlaps(), one cell per tile
 
     std::vector<EntityPtr> levelTemplate_;
 
@@ -358,6 +452,10 @@ private:
     double fearTimer_{0.0};
     double fearDuration_{10.0};
 
+    std::uint64_t tick_{0};
+    double simTime_{0.0};
+    SimStats stats_{}; ///< Shared with the entities' Subject base, see addEntity()
+
     double levelStartTime_{0.0};
     std::vector<std::shared_ptr<Ghost>> ghostReleaseQueue_;
     std::vector<double> ghostReleaseDelays_{0.0, 0.0, 5.0, 10.0};
@@ -368,6 +466,21 @@ private:
 
     double startDelayTimer_{0.0};
     double startDelayDuration_{1.0};
+
+    /**
+     * @brief Position of an actor in entities_, cached for snapshots.
+     */
+    struct ActorSlot {
+        std::size_t index{0};
+        bool ghost{false};
+    };
+
+    mutable std::vector<ActorSlot> actorSlots_;
+    mutable std::vector<std::size_t> pickupSlots_;
+    mutable bool stateSlotsValid_{false};
+
+    mutable BroadPhase wallGrid_;       ///< Walls only, for wallBlocks()
+    mutable bool wallGridValid_{false}; ///< Cleared whenever entities_ changes
 };
 
 } // namespace pacman::logic
\ No newline at end of file
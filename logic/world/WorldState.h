@@ -0,0 +1,67 @@
+#pragma once
+
+#include "../entities/Entity.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <type_traits>
+
+namespace pacman::logic {
+
+/**
+ * @brief Mutable state of a moving actor (Pac-Man or a ghost).
+ */
+struct ActorState {
+    Rect bounds{};                    ///< Current world-space bounds
+    double speed{0.0};                ///< Current movement speed
+    std::uint8_t direction{0};        ///< Applied direction (Direction)
+    std::uint8_t desiredDirection{0}; ///< Buffered direction (Pac-Man only)
+    std::uint8_t mode{0};             ///< Ghost mode (GhostMode, ghosts only)
+    std::uint8_t active{0};           ///< Entity active flag
+};
+
+/**
+ * @brief Gate pass entry referring to a ghost by its actor slot.
+ */
+struct GatePassState {
+    std::uint8_t actor{0};       ///< Index into WorldState::actors
+    std::uint8_t touchedGate{0}; ///< Whether the ghost already touched the gate
+};
+
+/**
+ * @brief Flat, trivially copyable image of all mutable World simulation state.
+ *
+ * Entities are referenced by their order in the world's entity list, so a state can only be restored
+ * into a world that loaded the same tile map. Static data (walls, spawn bounds, release delays) is not stored.
+ */
+struct WorldState {
+    static constexpr std::size_t MaxActors = 8;    ///< Pac-Man + ghosts
+    static constexpr std::size_t MaxPickups = 256; ///< Coins + fruits
+
+    std::uint32_t entityCount{0}; ///< Entity count of the source world (layout check)
+    std::uint64_t tick{0};        ///< Simulation tick counter
+    std::int32_t currentLevel{1};
+    std::int32_t lives{3};
+
+    double simTime{0.0};
+    double levelStartTime{0.0};
+    double fearTimer{0.0};
+    double fearDuration{10.0};
+    double startDelayTimer{0.0};
+
+    std::uint8_t fearActive{0};
+    std::uint8_t actorCount{0};
+    std::uint8_t gatePassCount{0};
+    std::uint8_t nextGhostToRelease{0};
+
+    ActorState actors[MaxActors]{};
+    GatePassState gatePass[MaxActors]{};
+    std::uint64_t pickups[MaxPickups / 64]{}; ///< One bit per pickup, set while still active
+
+    std::mt19937 rng{}; ///< Global Random engine state
+};
+
+static_assert(std::is_trivially_copyable_v<WorldState>, "WorldState must stay memcpy-able");
+
+} // namespace pacman::logic
@@ -0,0 +1,206 @@
+#include "TestSupport.h"
+
+#include "factory/ModelFactory.h"
+#include "replay/ReplayPlayer.h"
+#include "replay/ReplayReader.h"
+#include "replay/ReplayWriter.h"
+#include "utils/MappedFile.h"
+#include "utils/Random.h"
+#include "world/TileMap.h"
+#include "world/World.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace {
+
+using namespace pacman;
+
+constexpr double kTickDt = 1.0 / 60.0;
+constexpr double kKeyframeSeconds = 2.0;
+constexpr std::uint64_t kRecordedTicks = 3000;
+constexpr std::uint64_t kPressTick = 30; ///< Ticks into each level before the recorded player presses a key
+
+/**
+ * @brief Records a session the way LevelState does and returns the world state before every tick's input.
+ *
+ * The held direction is dropped when a level is cleared and pressed again kPressTick ticks into the next one,
+ * so the recording contains input changes on both sides of every level reload.
+ *
+ * @param path Replay file to write.
+ * @param map Builds the map to load.
+ * @param input Direction pressed for a tick count since the level started.
+ * @param levels Receives the level reached.
+ * @return One snapshot per tick, plus the state after the last update.
+ */
+std::vector<logic::WorldState> record(const std::string& path, logic::TileMap (*map)(),
+                                      logic::Direction (*input)(std::uint64_t), int& levels) {
+    logic::Random::getInstance().seed(5489u);
+
+    logic::ModelFactory factory;
+    logic::World world(factory);
+    world.loadLevel(map());
+
+    std::vector<logic::WorldState> states;
+    logic::ReplayWriter writer(path, kTickDt, kKeyframeSeconds);
+
+    logic::Direction held = logic::Direction::None;
+    std::uint64_t levelStart = 0;
+    for (std::uint64_t t = 0; t < kRecordedTicks && !world.isGameOver(); ++t) {
+        if (t - levelStart >= kPressTick) {
+            held = input(t - levelStart);
+        }
+
+        states.push_back(tests::snapshot(world));
+        if (held != logic::Direction::None) {
+            world.setPacManDirection(held);
+        }
+        writer.recordTick(world, held);
+        world.update(kTickDt);
+
+        if (world.isLevelCleared()) {
+            world.advanceLevel();
+            held = logic::Direction::None;
+            levelStart = t + 1;
+        }
+    }
+    states.push_back(tests::snapshot(world));
+    writer.finish();
+
+    levels = world.currentLevel();
+    return states;
+}
+
+/**
+ * @brief Returns a snapshot with the Random engine state cleared.
+ *
+ * The player swaps its own engine out after simulating, so the global engine seen in the world's snapshot is the
+ * caller's, not the recording's.
+ */
+logic::WorldState withoutRng(logic::WorldState state) {
+    state.rng = {};
+    return state;
+}
+
+/**
+ * @brief Records a session, plays it back linearly and checks that seeking lands on the same states.
+ * @param checker Collects the results.
+ * @param name Map name for the report.
+ * @param map Builds the map to load.
+ * @param input Direction pressed for a tick count since the level started.
+ * @param minLevel Level the recording must reach, so seeking across level reloads is covered.
+ */
+void checkSeek(tests::Checker& checker, const std::string& name, logic::TileMap (*map)(),
+               logic::Direction (*input)(std::uint64_t), int minLevel) {
+    const std::string path = "ReplaySeekTest.replay";
+
+    int levels = 0;
+    const std::vector<logic::WorldState> recorded = record(path, map, input, levels);
+    checker.check(levels >= minLevel, name + ": recording reaches level " + std::to_string(minLevel));
+
+    logic::MappedFile file(path);
+    if (!checker.check(file.isOpen(), name + ": replay file opens")) {
+        return;
+    }
+    logic::ReplayReader reader(file.data(), file.size());
+    if (!checker.check(reader.isValid(), name + ": replay is valid")) {
+        return;
+    }
+    checker.check(reader.endTick() + 1 == recorded.size(), name + ": end tick matches the recording");
+    checker.check(reader.keyframeCount() > 1, name + ": replay has several keyframes");
+
+    // Linear playback from the first tick must reproduce the recording.
+    logic::ModelFactory linearFactory;
+    logic::World linearWorld(linearFactory);
+    linearWorld.loadLevel(map());
+    logic::ReplayPlayer linear(linearWorld, reader);
+    if (!checker.check(linear.seek(0), name + ": seek to tick 0")) {
+        return;
+    }
+
+    std::vector<logic::WorldState> played{withoutRng(tests::snapshot(linearWorld))};
+    while (linear.advance(1) == 1) {
+        played.push_back(withoutRng(tests::snapshot(linearWorld)));
+    }
+    checker.check(played.size() == recorded.size(), name + ": linear playback covers the recording");
+
+    std::size_t mismatches = 0;
+    for (std::size_t t = 0; t < played.size() && t < recorded.size(); ++t) {
+        mismatches += tests::sameState(played[t], withoutRng(recorded[t])) ? 0 : 1;
+    }
+    checker.check(mismatches == 0, name + ": linear playback matches the recording");
+
+    // Seeking, forwards and backwards, must land on the linearly played state.
+    logic::ModelFactory seekFactory;
+    logic::World seekWorld(seekFactory);
+    seekWorld.loadLevel(map());
+    logic::ReplayPlayer seeker(seekWorld, reader);
+
+    const std::uint64_t interval = reader.header().keyframeInterval;
+    std::vector<std::uint64_t> targets{played.size() - 1, 0, 1, interval - 1, interval, interval + 1};
+    for (std::uint64_t t = 7; t < played.size(); t += 97) {
+        targets.push_back(t);
+    }
+
+    for (const std::uint64_t target : targets) {
+        if (target >= played.size()) {
+            continue;
+        }
+        const auto before = logic::Random::getInstance().engineState();
+        const bool sought = seeker.seek(target);
+        const std::string at = name + ": seek to tick " + std::to_string(target);
+        if (!checker.check(sought, at)) {
+            continue;
+        }
+        checker.check(seekWorld.tick() == target, at + " lands on that tick");
+        checker.check(tests::sameState(withoutRng(tests::snapshot(seekWorld)), played[target]),
+                      at + " matches linear playback");
+        checker.check(logic::Random::getInstance().engineState() == before, at + " leaves the global Random alone");
+    }
+}
+
+/**
+ * @brief Checks that a replay whose trailer claims an impossible index size is rejected.
+ *
+ * The count is chosen so that count * sizeof(ReplayIndexEntry) wraps around to the real index size.
+ *
+ * @param checker Collects the results.
+ */
+void checkCraftedTrailer(tests::Checker& checker) {
+    int levels = 0;
+    record("ReplaySeekTest.replay", tests::corridorMap, tests::holdRight, levels);
+
+    logic::MappedFile file("ReplaySeekTest.replay");
+    if (!checker.check(file.isOpen(), "crafted trailer: replay file opens")) {
+        return;
+    }
+    std::vector<std::byte> image(file.data(), file.data() + file.size());
+
+    logic::ReplayTrailer trailer{};
+    std::memcpy(&trailer, image.data() + image.size() - sizeof(trailer), sizeof(trailer));
+    checker.check(logic::ReplayReader(image.data(), image.size()).isValid(), "crafted trailer: original is valid");
+
+    static_assert(sizeof(logic::ReplayIndexEntry) == 16, "2^60 entries of 16 bytes wrap to zero");
+    trailer.indexCount += std::uint64_t{1} << 60;
+    std::memcpy(image.data() + image.size() - sizeof(trailer), &trailer, sizeof(trailer));
+    checker.check(!logic::ReplayReader(image.data(), image.size()).isValid(),
+                  "crafted trailer: wrapping index count is rejected");
+}
+
+/**
+ * @brief Returns the scripted input of the built-in map for a tick count since the level started.
+ */
+logic::Direction scripted(std::uint64_t ticks) { return tests::scriptedInput(ticks); }
+
+} // namespace
+
+int main() {
+    tests::Checker checker;
+    checkSeek(checker, "built-in map", [] { return logic::TileMap{}; }, scripted, 1);
+    checkSeek(checker, "corridor map", tests::corridorMap, tests::holdRight, 3);
+    checkCraftedTrailer(checker);
+    return checker.exitCode();
+}
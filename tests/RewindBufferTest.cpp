@@ -0,0 +1,120 @@
+#include "TestSupport.h"
+
+#include "factory/ModelFactory.h"
+#include "replay/RewindBuffer.h"
+#include "score/Score.h"
+#include "utils/Random.h"
+#include "world/TileMap.h"
+#include "world/World.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace {
+
+using namespace pacman;
+
+constexpr double kTickDt = 1.0 / 60.0;
+constexpr std::uint64_t kRecordedTicks = 2400;
+
+/**
+ * @brief World state and score after one recorded tick.
+ */
+struct Frame {
+    logic::WorldState world{};
+    int score{0};
+};
+
+/**
+ * @brief Returns whether a world and score match a recorded frame.
+ */
+bool matches(const logic::World& world, const logic::Score& score, const Frame& frame) {
+    return tests::sameState(tests::snapshot(world), frame.world) && score.value() == frame.score;
+}
+
+/**
+ * @brief Simulates ticks and records each one into the buffer, keeping a full copy of every frame to compare with.
+ * @param world World to step.
+ * @param score Score fed by the world's pickups.
+ * @param buffer Buffer under test.
+ * @param input Direction requested per tick index.
+ * @param ticks Number of steps.
+ * @param frames Receives one frame per recorded tick.
+ */
+void play(logic::World& world, logic::Score& score, logic::RewindBuffer& buffer,
+          logic::Direction (*input)(std::uint64_t), std::uint64_t ticks, std::vector<Frame>& frames) {
+    for (std::uint64_t t = 0; t < ticks && !world.isGameOver(); ++t) {
+        world.setPacManDirection(input(world.tick()));
+        world.update(kTickDt);
+        if (world.isLevelCleared()) {
+            world.advanceLevel();
+        }
+        buffer.record(world, score);
+        frames.push_back({tests::snapshot(world), score.value()});
+    }
+}
+
+/**
+ * @brief Checks that stepping back N frames restores exactly the frame recorded N ticks earlier.
+ * @param checker Collects the results.
+ * @param name Case name for the report.
+ * @param map Builds the map to load.
+ * @param input Direction requested per tick index.
+ * @param buffer Buffer under test (empty).
+ */
+void checkStepBack(tests::Checker& checker, const std::string& name, logic::TileMap (*map)(),
+                   logic::Direction (*input)(std::uint64_t), logic::RewindBuffer buffer) {
+    logic::Random::getInstance().seed(5489u);
+
+    logic::Score score;
+    logic::ModelFactory factory;
+    factory.setScoreObserver(&score);
+    logic::World world(factory);
+    world.loadLevel(map());
+
+    std::vector<Frame> frames;
+    play(world, score, buffer, input, kRecordedTicks, frames);
+    if (!checker.check(buffer.available() > 0, name + ": history recorded")) {
+        return;
+    }
+    checker.check(buffer.available() < frames.size(), name + ": oldest frames evicted");
+
+    for (const std::size_t steps : {std::size_t{1}, std::size_t{59}, std::size_t{240}}) {
+        const std::size_t newest = frames.size() - 1;
+        const std::size_t stepped = buffer.stepBack(steps, world, score);
+        const std::string at = name + ": step back " + std::to_string(steps);
+        if (!checker.check(stepped == steps, at + " steps that far")) {
+            return;
+        }
+        checker.check(matches(world, score, frames[newest - stepped]), at + " restores the frame from then");
+        frames.resize(newest - stepped + 1);
+    }
+
+    // Recording continues from the restored frame.
+    play(world, score, buffer, input, 120, frames);
+    const std::size_t newest = frames.size() - 1;
+    const std::size_t stepped = buffer.stepBack(180, world, score);
+    checker.check(stepped == 180, name + ": steps back across the resumed recording");
+    checker.check(matches(world, score, frames[newest - stepped]), name + ": restores the frame before resuming");
+
+    // Stepping back past the oldest frame stops there.
+    const std::size_t rest = buffer.available();
+    const std::size_t oldest = frames.size() - 1 - stepped - rest;
+    checker.check(buffer.stepBack(rest + 100, world, score) == rest, name + ": stops at the oldest frame");
+    checker.check(matches(world, score, frames[oldest]), name + ": restores the oldest frame");
+    checker.check(buffer.available() == 0 && buffer.stepBack(1, world, score) == 0, name + ": history exhausted");
+}
+
+} // namespace
+
+int main() {
+    tests::Checker checker;
+    checkStepBack(checker, "built-in map", [] { return logic::TileMap{}; }, tests::scriptedInput,
+                  logic::RewindBuffer::forTickRate(kTickDt, 30.0));
+    checkStepBack(checker, "corridor map", tests::corridorMap, tests::holdRight,
+                  logic::RewindBuffer::forTickRate(kTickDt, 30.0));
+    checkStepBack(checker, "byte budget", [] { return logic::TileMap{}; }, tests::scriptedInput,
+                  logic::RewindBuffer(80000, 1800));
+    return checker.exitCode();
+}
@@ -0,0 +1,84 @@
+#include "TestSupport.h"
+
+#include "factory/ModelFactory.h"
+#include "utils/Random.h"
+#include "world/TileMap.h"
+#include "world/World.h"
+
+#include <cstdint>
+#include <string>
+
+namespace {
+
+using namespace pacman;
+
+constexpr double kTickDt = 1.0 / 60.0;
+constexpr std::uint64_t kTicksBeforeSave = 600;
+constexpr std::uint64_t kTicksAfterSave = 900;
+
+using Input = logic::Direction (*)(std::uint64_t);
+
+/**
+ * @brief Simulates ticks with generated input, moving on when a level is cleared.
+ * @param world World to step.
+ * @param input Direction requested per tick index.
+ * @param from Tick index of the first step.
+ * @param ticks Number of steps.
+ */
+void play(logic::World& world, Input input, std::uint64_t from, std::uint64_t ticks) {
+    for (std::uint64_t t = from; t < from + ticks && !world.isGameOver(); ++t) {
+        world.setPacManDirection(input(t));
+        world.update(kTickDt);
+        if (world.isLevelCleared()) {
+            world.advanceLevel();
+        }
+    }
+}
+
+/**
+ * @brief Saves a world mid-run, restores it into a fresh world and checks that both continue identically.
+ * @param checker Collects the results.
+ * @param name Map name for the report.
+ * @param map Builds the map to load.
+ * @param input Direction requested per tick index.
+ * @param minLevel Level the run must reach, so level reloads after the save are covered.
+ */
+void checkRoundTrip(tests::Checker& checker, const std::string& name, logic::TileMap (*map)(), Input input,
+                    int minLevel) {
+    logic::Random::getInstance().seed(5489u);
+
+    logic::ModelFactory factory;
+    logic::World original(factory);
+    original.loadLevel(map());
+    play(original, input, 0, kTicksBeforeSave);
+
+    logic::WorldState saved{};
+    if (!checker.check(original.saveState(saved), name + ": saveState")) {
+        return;
+    }
+
+    play(original, input, kTicksBeforeSave, kTicksAfterSave);
+    const logic::WorldState expected = tests::snapshot(original);
+    checker.check(original.currentLevel() >= minLevel, name + ": run reaches level " + std::to_string(minLevel));
+
+    logic::ModelFactory freshFactory;
+    logic::World fresh(freshFactory);
+    fresh.loadLevel(map());
+    if (!checker.check(fresh.restoreState(saved), name + ": restoreState into a fresh world")) {
+        return;
+    }
+    checker.check(tests::sameState(tests::snapshot(fresh), saved), name + ": restored state equals the saved one");
+
+    play(fresh, input, kTicksBeforeSave, kTicksAfterSave);
+    checker.check(fresh.tick() == original.tick(), name + ": same tick after re-simulating");
+    checker.check(tests::sameState(tests::snapshot(fresh), expected), name + ": same state after re-simulating");
+}
+
+} // namespace
+
+int main() {
+    tests::Checker checker;
+    checkRoundTrip(checker, "built-in map", [] { return logic::TileMap{}; }, tests::scriptedInput, 1);
+    checkRoundTrip(checker, "corridor map", tests::corridorMap, tests::holdRight, 3);
+    return checker.exitCode();
+}
@@ -0,0 +1,87 @@
+#pragma once
+
+#include "entities/Direction.h"
+#include "world/WorldState.h"
+#include "world/World.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace pacman::tests {
+
+/**
+ * @brief Counts failed checks of one test executable.
+ */
+class Checker {
+public:
+    /**
+     * @brief Records a check and prints it if it failed.
+     * @param ok Outcome of the check.
+     * @param what Description of what was checked.
+     * @return The outcome, so callers can stop early.
+     */
+    bool check(bool ok, const std::string& what) {
+        if (!ok) {
+            std::fprintf(stderr, "FAILED: %s\n", what.c_str());
+            ++failures_;
+        }
+        return ok;
+    }
+
+    /**
+     * @brief Returns the process exit code: 0 if every check held, 1 otherwise.
+     */
+    int exitCode() const noexcept { return failures_ == 0 ? 0 : 1; }
+
+private:
+    int failures_{0};
+};
+
+/**
+ * @brief Returns the scripted input for a tick: a new direction every 47 ticks, cycling through all four.
+ * @param tick Tick index.
+ * @return Direction to request.
+ */
+inline logic::Direction scriptedInput(std::uint64_t tick) {
+    static constexpr logic::Direction order[] = {logic::Direction::Up, logic::Direction::Left, logic::Direction::Down,
+                                                 logic::Direction::Right};
+    return order[(tick / 47) % 4];
+}
+
+/**
+ * @brief Returns Right for every tick: clears corridorMap() level after level.
+ */
+inline logic::Direction holdRight(std::uint64_t) { return logic::Direction::Right; }
+
+/**
+ * @brief Small level that holding Right clears in about five seconds, so runs cross World::advanceLevel().
+ *
+ * All pickups lie on Pac-Man's row; the ghosts roam the room below and reach the row through the two openings.
+ */
+inline logic::TileMap corridorMap() {
+    return logic::TileMap{std::vector<std::string>{"###########", "#P.......F#", "#  #####  #", "#    G    #",
+                                                   "###########"}};
+}
+
+/**
+ * @brief Takes a snapshot of a world.
+ * @param world World to snapshot.
+ * @return Snapshot (value-initialized, so it compares byte-wise).
+ */
+inline logic::WorldState snapshot(const logic::World& world) {
+    logic::WorldState state{};
+    world.saveState(state);
+    return state;
+}
+
+/**
+ * @brief Returns whether two snapshots are byte-identical.
+ */
+inline bool sameState(const logic::WorldState& a, const logic::WorldState& b) {
+    return std::memcmp(&a, &b, sizeof(logic::WorldState)) == 0;
+}
+
+} // namespace pacman::tests
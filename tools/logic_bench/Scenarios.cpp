@@ -0,0 +1,239 @@
+#include "Scenarios.h"
+
+#include "factory/ModelFactory.h"
+#include "score/Score.h"
+#include "utils/AllocationCounter.h"
+#include "utils/Random.h"
+#include "world/World.h"
+
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace pacman::bench {
+
+namespace {
+
+constexpr double kTickDt = 1.0 / 60.0;
+
+constexpr int kMazeSize = 200;                  ///< Width and height of the synthetic maze in tiles
+constexpr int kMazeSpawnGrid = 4;               ///< Ghost spawns per axis (4 ghosts each: 64 ghosts)
+constexpr int kMazeCoinOneIn = 40;              ///< Roughly one corridor tile in this many holds a coin
+constexpr std::uint32_t kMazeSeed = 0x4d415a45; ///< Maze layout seed, independent of the run seed
+
+/**
+ * @brief Returns the built-in level.
+ */
+logic::TileMap builtinMap() { return logic::TileMap{}; }
+
+/**
+ * @brief Builds a kMazeSize x kMazeSize maze with a fixed layout.
+ *
+ * Corridors are carved by a depth-first walk over the odd tile coordinates, so every corridor tile is reachable
+ * from Pac-Man's spawn in the top-left corner. Ghost spawns sit in 3x3 rooms on an even grid over the maze.
+ */
+logic::TileMap mazeMap() {
+    std::vector<std::string> rows(kMazeSize, std::string(kMazeSize, '#'));
+    std::mt19937 rng(kMazeSeed);
+
+    // Cells are the odd coordinates; the last row and column stay wall because kMazeSize is even.
+    constexpr int cells = (kMazeSize - 1) / 2;
+    std::vector<std::uint8_t> visited(static_cast<std::size_t>(cells) * cells, 0);
+    std::vector<std::pair<int, int>> stack{{0, 0}};
+    visited[0] = 1;
+    rows[1][1] = ' ';
+
+    static constexpr std::array<std::pair<int, int>, 4> steps{{{1, 0}, {-1, 0}, {0, 1}, {0, -1}}};
+    while (!stack.empty()) {
+        const auto [cx, cy] = stack.back();
+
+        std::array<std::pair<int, int>, 4> open{};
+        std::size_t count = 0;
+        for (const auto& [dx, dy] : steps) {
+            const int nx = cx + dx;
+            const int ny = cy + dy;
+            if (nx >= 0 && nx < cells && ny >= 0 && ny < cells && !visited[static_cast<std::size_t>(ny * cells + nx)]) {
+                open[count++] = {nx, ny};
+            }
+        }
+
+        if (count == 0) {
+            stack.pop_back();
+            continue;
+        }
+
+        const auto [nx, ny] = open[rng() % count];
+        visited[static_cast<std::size_t>(ny * cells + nx)] = 1;
+        rows[cy + ny + 1][cx + nx + 1] = ' ';
+        rows[2 * ny + 1][2 * nx + 1] = ' ';
+        stack.emplace_back(nx, ny);
+    }
+
+    for (int y = 1; y < kMazeSize - 1; ++y) {
+        for (int x = 1; x < kMazeSize - 1; ++x) {
+            if (rows[y][x] == ' ' && rng() % kMazeCoinOneIn == 0) {
+                rows[y][x] = '.';
+            }
+        }
+    }
+
+    constexpr int spacing = kMazeSize / kMazeSpawnGrid;
+    for (int gy = 0; gy < kMazeSpawnGrid; ++gy) {
+        for (int gx = 0; gx < kMazeSpawnGrid; ++gx) {
+            const int x = gx * spacing + spacing / 2 + 1;
+            const int y = gy * spacing + spacing / 2 + 1;
+            for (int ry = y - 1; ry <= y + 1; ++ry) {
+                for (int rx = x - 1; rx <= x + 1; ++rx) {
+                    rows[ry][rx] = ' ';
+                }
+            }
+            rows[y][x] = 'G';
+        }
+    }
+
+    rows[1][1] = 'P';
+    return logic::TileMap{rows};
+}
+
+// Floors assume an optimized build (-O2 or better) and sit about three times below what a plain -O2 build
+// reaches (11000-16000 ticks/s on the built-in map, 125-150 on the maze), so they catch complexity regressions
+// rather than machine noise. Allocation ceilings sit about a third above today's counts (the entity phase still
+// allocates per moving actor) and are only enforced in a PACMAN_ALLOC_TRACKING build.
+constexpr std::array<Scenario, 5> kScenarios{{
+    {"idle", "built-in map, no input", builtinMap, 1, false, false, 60, 3000, 3500.0, 10.0},
+    {"chase", "built-in map, scripted input at full speed", builtinMap, 1, true, false, 60, 3000, 3500.0, 10.0},
+    {"fear", "built-in map, all four ghosts released and fleeing", builtinMap, 1, true, true, 660, 3000, 3500.0,
+     10.0},
+    {"maze200", "200x200 synthetic maze with 64 ghosts", mazeMap, 1, true, false, 60, 600, 40.0, 360.0},
+    {"level20", "built-in map at level 20 speed scaling", builtinMap, 20, true, false, 60, 3000, 3500.0, 10.0},
+}};
+
+} // namespace
+
+logic::Direction scriptedInput(std::uint64_t tick) {
+    static constexpr logic::Direction order[] = {logic::Direction::Up, logic::Direction::Left, logic::Direction::Down,
+                                                 logic::Direction::Right};
+    return order[(tick / 47) % 4];
+}
+
+std::span<const Scenario> scenarios() { return kScenarios; }
+
+ScenarioResult runScenario(const Scenario& scenario, std::uint32_t seed) {
+    logic::Random::getInstance().seed(seed);
+
+    logic::Score score;
+    logic::ModelFactory factory;
+    factory.setScoreObserver(&score);
+
+    logic::World world(factory);
+    world.loadLevel(scenario.map());
+    while (world.currentLevel() < scenario.level) {
+        world.advanceLevel();
+    }
+
+    using Clock = std::chrono::steady_clock;
+    Clock::duration elapsed{};
+    std::uint64_t allocations = 0;
+
+    for (std::uint64_t tick = 0; tick < scenario.warmupTicks + scenario.ticks; ++tick) {
+        const bool measured = tick >= scenario.warmupTicks;
+
+        if (scenario.steer) {
+            world.setPacManDirection(scriptedInput(tick));
+        }
+        if (scenario.fear && measured && !world.isFearActive()) {
+            world.startFearMode();
+        }
+
+        const auto allocationsBefore = logic::AllocationCounter::threadStats().allocations;
+        const auto start = Clock::now();
+        world.update(kTickDt);
+        if (measured) {
+            elapsed += Clock::now() - start;
+            allocations += logic::AllocationCounter::threadStats().allocations - allocationsBefore;
+        }
+
+        // Keep the workload going: a cleared level moves on, a lost game only refills the lives so the level and
+        // its speed scaling stay in place.
+        if (world.isLevelCleared()) {
+            world.advanceLevel();
+        } else if (world.isGameOver()) {
+            world.resetLives();
+        }
+    }
+
+    ScenarioResult result;
+    const double seconds = std::chrono::duration<double>(elapsed).count();
+    const double ticks = static_cast<double>(scenario.ticks ? scenario.ticks : 1);
+    result.ticksPerSecond = seconds > 0.0 ? static_cast<double>(scenario.ticks) / seconds : 0.0;
+    result.allocationsPerTick = static_cast<double>(allocations) / ticks;
+    result.entities = static_cast<std::uint32_t>(world.entities().size());
+    result.fastEnough = result.ticksPerSecond >= scenario.minTicksPerSecond;
+    result.allocationsChecked = logic::AllocationCounter::enabled();
+    result.withinAllocations =
+        !result.allocationsChecked || result.allocationsPerTick <= scenario.maxAllocationsPerTick;
+    return result;
+}
+
+int runScenarios(const char* name, std::uint32_t seed, bool requireAllocationTracking) {
+    const bool all = std::strcmp(name, "all") == 0;
+    const auto selected = [&](const Scenario& scenario) { return all || std::strcmp(name, scenario.name) == 0; };
+
+    bool found = false;
+    for (const Scenario& scenario : scenarios()) {
+        found = found || selected(scenario);
+    }
+    if (!found) {
+        std::fprintf(stderr, "unknown scenario '%s'; known:", name);
+        for (const Scenario& scenario : scenarios()) {
+            std::fprintf(stderr, " %s", scenario.name);
+        }
+        std::fprintf(stderr, " all\n");
+        return 2;
+    }
+
+    std::printf("%-8s %7s %12s %12s %10s %10s  %s\n", "scenario", "ticks", "ticks/s", "floor", "allocs/t",
+                "ceiling", "result");
+
+    bool failed = false;
+    for (const Scenario& scenario : scenarios()) {
+        if (!selected(scenario)) {
+            continue;
+        }
+
+        const ScenarioResult result = runScenario(scenario, seed);
+        failed = failed || !result.passed();
+
+        char allocations[16] = "n/a";
+        if (result.allocationsChecked) {
+            std::snprintf(allocations, sizeof(allocations), "%.2f", result.allocationsPerTick);
+        }
+
+        std::printf("%-8s %7llu %12.1f %12.1f %10s %10.2f  %s%s%s\n", scenario.name,
+                    static_cast<unsigned long long>(scenario.ticks), result.ticksPerSecond,
+                    scenario.minTicksPerSecond, allocations, scenario.maxAllocationsPerTick,
+                    result.passed() ? "PASS" : "FAIL", result.fastEnough ? "" : " (too slow)",
+                    result.withinAllocations ? "" : " (too many allocations)");
+        std::printf("         %s, %u entities\n", scenario.description, result.entities);
+    }
+
+    const bool checked = logic::AllocationCounter::enabled();
+    if (!checked) {
+        std::printf("allocation ceilings not checked: build with PACMAN_ALLOC_TRACKING=ON\n");
+    }
+    if (failed) {
+        return 1;
+    }
+    if (!checked && requireAllocationTracking) {
+        std::fprintf(stderr, "SKIPPED: allocation ceilings required, but this build does not count allocations\n");
+        return kScenariosSkipped;
+    }
+    return 0;
+}
+
+} // namespace pacman::bench
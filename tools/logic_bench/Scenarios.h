@@ -0,0 +1,81 @@
+#pragma once
+
+#include "entities/Direction.h"
+#include "world/TileMap.h"
+
+#include <cstdint>
+#include <span>
+
+namespace pacman::bench {
+
+/**
+ * @brief Returns the scripted input for a tick: a new direction every 47 ticks, cycling through all four.
+ * @param tick Tick index.
+ * @return Direction to request.
+ */
+logic::Direction scriptedInput(std::uint64_t tick);
+
+/**
+ * @brief Canned, deterministic workload with the performance it must reach.
+ *
+ * A scenario loads its map, optionally advances to a later level, and then runs a fixed number of ticks from a
+ * fixed seed. Only the measured ticks count towards the limits; warm-up ticks (ghost release, first allocations)
+ * and level reloads are excluded.
+ */
+struct Scenario {
+    const char* name;             ///< Name used on the command line
+    const char* description;      ///< One-line summary for the report
+    logic::TileMap (*map)();      ///< Builds the map to load
+    int level;                    ///< Level to advance to before running (1: none)
+    bool steer;                   ///< Whether Pac-Man follows scriptedInput()
+    bool fear;                    ///< Whether fear mode is kept active during the measured ticks
+    std::uint64_t warmupTicks;    ///< Ticks simulated before measuring
+    std::uint64_t ticks;          ///< Measured ticks
+    double minTicksPerSecond;     ///< Floor for World::update throughput
+    double maxAllocationsPerTick; ///< Ceiling for heap allocations per measured tick
+};
+
+/**
+ * @brief Outcome of one scenario run.
+ */
+struct ScenarioResult {
+    double ticksPerSecond{0.0};     ///< Measured World::update throughput
+    double allocationsPerTick{0.0}; ///< Heap allocations per measured tick (0 without PACMAN_ALLOC_TRACKING)
+    std::uint32_t entities{0};      ///< Entities in the world after the run
+    bool fastEnough{false};         ///< ticksPerSecond reached the floor
+    bool allocationsChecked{false}; ///< Allocations were counted (PACMAN_ALLOC_TRACKING build)
+    bool withinAllocations{true};   ///< allocationsPerTick stayed under the ceiling (true when not checked)
+
+    /**
+     * @brief Returns whether all checked limits held.
+     */
+    bool passed() const noexcept { return fastEnough && withinAllocations; }
+};
+
+/**
+ * @brief Returns all built-in scenarios.
+ */
+std::span<const Scenario> scenarios();
+
+/**
+ * @brief Runs a scenario from a freshly seeded world.
+ * @param scenario Scenario to run.
+ * @param seed Seed of the global Random engine.
+ * @return Measured values and verdict.
+ */
+ScenarioResult runScenario(const Scenario& scenario, std::uint32_t seed);
+
+/// Exit code of runScenarios() when the allocation ceilings were required but could not be checked (CTest skip).
+inline constexpr int kScenariosSkipped = 77;
+
+/**
+ * @brief Runs the named scenario, or all of them for "all", and prints one line per scenario.
+ * @param name Scenario name or "all".
+ * @param seed Seed of the global Random engine.
+ * @param requireAllocationTracking Whether passing floors without counted allocations reports kScenariosSkipped.
+ * @return 0 if every scenario passed, 1 if one failed, 2 for an unknown name, kScenariosSkipped if the floors held
+ *         but the required allocation ceilings were not checked.
+ */
+int runScenarios(const char* name, std::uint32_t seed, bool requireAllocationTracking = false);
+
+} // namespace pacman::bench
@@ -0,0 +1,256 @@
+#include "Soak.h"
+
+#include "entities/Direction.h"
+#include "factory/ModelFactory.h"
+#include "score/Score.h"
+#include "utils/AllocationCounter.h"
+#include "utils/ProcessMemory.h"
+#include "utils/Random.h"
+#include "world/TileMap.h"
+#include "world/World.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace pacman::bench {
+
+namespace {
+
+constexpr double kTickDt = 1.0 / 60.0;
+constexpr std::uint64_t kInputTicks = 30;              ///< Ticks between the bot's direction changes
+constexpr std::size_t kTrendWindows = 8;               ///< Windows compared by detectGrowth()
+constexpr std::uint64_t kRssTolerance = 1024 * 1024;   ///< RSS rise treated as allocator noise
+constexpr std::uint64_t kLiveAllocationTolerance = 64; ///< Live allocation rise treated as noise
+
+/**
+ * @brief Returns whether a path ends in ".json".
+ */
+bool wantsJson(const char* path) {
+    const std::size_t length = std::strlen(path);
+    return length >= 5 && std::strcmp(path + length - 5, ".json") == 0;
+}
+
+/**
+ * @brief Writes the samples as CSV with a header row.
+ * @param out Destination stream.
+ * @param samples Samples in order.
+ */
+void writeCsv(std::ofstream& out, const std::vector<SoakSample>& samples) {
+    out << "level,world_level,tick,seconds,rss_bytes,live_allocations,allocations,entities\n";
+    for (const SoakSample& s : samples) {
+        out << s.level << ',' << s.worldLevel << ',' << s.tick << ',' << s.seconds << ',' << s.rssBytes << ','
+            << s.liveAllocations << ',' << s.allocations << ',' << s.entities << '\n';
+    }
+}
+
+/**
+ * @brief Writes one trend as a JSON object.
+ * @param out Destination stream.
+ * @param trend Trend to write.
+ */
+void writeTrend(std::ofstream& out, const GrowthTrend& trend) {
+    out << "{\"growing\": " << (trend.growing ? "true" : "false") << ", \"perLevel\": " << trend.perLevel
+        << ", \"first\": " << trend.first << ", \"last\": " << trend.last << '}';
+}
+
+/**
+ * @brief Writes the run settings, both trends and the samples as one JSON document.
+ * @param out Destination stream.
+ * @param options Run settings.
+ * @param samples Samples in order.
+ * @param rss Trend of the resident set size.
+ * @param live Trend of the live allocations.
+ */
+void writeJson(std::ofstream& out, const SoakOptions& options, const std::vector<SoakSample>& samples,
+               const GrowthTrend& rss, const GrowthTrend& live) {
+    out << "{\n  \"levels\": " << options.levels << ",\n  \"ticksPerLevel\": " << options.ticksPerLevel
+        << ",\n  \"difficultyCycle\": " << options.difficultyCycle << ",\n  \"seed\": " << options.seed
+        << ",\n  \"rssGrowth\": ";
+    writeTrend(out, rss);
+    out << ",\n  \"liveAllocationGrowth\": ";
+    writeTrend(out, live);
+    out << ",\n  \"samples\": [";
+    for (std::size_t i = 0; i < samples.size(); ++i) {
+        const SoakSample& s = samples[i];
+        out << (i ? ",\n    " : "\n    ") << "{\"level\": " << s.level << ", \"worldLevel\": " << s.worldLevel
+            << ", \"tick\": " << s.tick << ", \"seconds\": " << s.seconds << ", \"rssBytes\": " << s.rssBytes
+            << ", \"liveAllocations\": " << s.liveAllocations << ", \"allocations\": " << s.allocations
+            << ", \"entities\": " << s.entities << '}';
+    }
+    out << "\n  ]\n}\n";
+}
+
+/**
+ * @brief Prints one trend line of the summary.
+ * @param label Series name.
+ * @param trend Trend to print.
+ * @param unit Unit of the values.
+ */
+void printTrend(const char* label, const GrowthTrend& trend, const char* unit) {
+    std::printf("%-17s %s: %llu -> %llu %s (%+.2f per level)\n", label, trend.growing ? "GROWING" : "stable",
+                static_cast<unsigned long long>(trend.first), static_cast<unsigned long long>(trend.last), unit,
+                trend.perLevel);
+}
+
+} // namespace
+
+GrowthTrend detectGrowth(std::span<const std::uint64_t> values, std::uint64_t tolerance) {
+    GrowthTrend trend;
+
+    const std::size_t skip = values.size() / 10;
+    const std::span<const std::uint64_t> series = values.subspan(skip);
+    const std::size_t windowSize = series.size() / kTrendWindows;
+    if (windowSize < 2) {
+        return trend;
+    }
+
+    bool monotonic = true;
+    std::uint64_t previous = 0;
+    for (std::size_t w = 0; w < kTrendWindows; ++w) {
+        const auto window = series.subspan(w * windowSize, windowSize);
+        const std::uint64_t floor = *std::min_element(window.begin(), window.end());
+        if (w == 0) {
+            trend.first = floor;
+        } else if (floor < previous) {
+            monotonic = false;
+        }
+        previous = floor;
+    }
+    trend.last = previous;
+    trend.growing = monotonic && trend.last > trend.first + tolerance;
+
+    const double n = static_cast<double>(series.size());
+    double sumX = 0.0;
+    double sumY = 0.0;
+    double sumXY = 0.0;
+    double sumXX = 0.0;
+    for (std::size_t i = 0; i < series.size(); ++i) {
+        const double x = static_cast<double>(i);
+        const double y = static_cast<double>(series[i]);
+        sumX += x;
+        sumY += y;
+        sumXY += x * y;
+        sumXX += x * x;
+    }
+    const double denominator = n * sumXX - sumX * sumX;
+    trend.perLevel = denominator > 0.0 ? (n * sumXY - sumX * sumY) / denominator : 0.0;
+
+    return trend;
+}
+
+int runSoak(const SoakOptions& options) {
+    logic::Random::getInstance().seed(options.seed);
+    std::mt19937 input(options.seed);
+
+    logic::Score score;
+    logic::ModelFactory factory;
+    factory.setScoreObserver(&score);
+
+    logic::World world(factory);
+    world.loadLevel(logic::TileMap{});
+
+    logic::WorldState levelOne{};
+    const bool canResetDifficulty = world.saveState(levelOne);
+
+    using Clock = std::chrono::steady_clock;
+    const auto start = Clock::now();
+    std::uint64_t tick = 0;
+    std::uint64_t cleared = 0;
+
+    std::vector<SoakSample> samples;
+    samples.reserve(static_cast<std::size_t>(options.levels));
+
+    const bool haveRss = logic::residentSetBytes().has_value();
+    const std::uint64_t progressEvery = std::max<std::uint64_t>(options.levels / 10, 1);
+
+    for (std::uint64_t level = 1; level <= options.levels; ++level) {
+        for (std::uint64_t t = 0; t < options.ticksPerLevel; ++t, ++tick) {
+            if (tick % kInputTicks == 0) {
+                world.setPacManDirection(static_cast<logic::Direction>(1 + input() % 4));
+            }
+            world.update(kTickDt);
+
+            if (world.isLevelCleared()) {
+                ++cleared;
+                break;
+            }
+            if (world.isGameOver()) {
+                world.resetLives();
+            }
+        }
+
+        world.advanceLevel();
+        if (canResetDifficulty && options.difficultyCycle != 0 && level % options.difficultyCycle == 0) {
+            auto& random = logic::Random::getInstance();
+            const auto engine = random.engineState();
+            world.restoreState(levelOne);
+            random.setEngineState(engine);
+        }
+
+        const logic::AllocationStats allocations = logic::AllocationCounter::threadStats();
+        SoakSample sample;
+        sample.level = level;
+        sample.tick = tick;
+        sample.seconds = std::chrono::duration<double>(Clock::now() - start).count();
+        sample.rssBytes = logic::residentSetBytes().value_or(0);
+        sample.liveAllocations = allocations.allocations - allocations.frees;
+        sample.allocations = allocations.allocations;
+        sample.entities = world.entities().size();
+        sample.worldLevel = world.currentLevel();
+        samples.push_back(sample);
+
+        if (level % progressEvery == 0) {
+            std::printf("level %llu/%llu, %.0f s, rss %.1f MiB\n", static_cast<unsigned long long>(level),
+                        static_cast<unsigned long long>(options.levels), sample.seconds,
+                        static_cast<double>(sample.rssBytes) / (1024.0 * 1024.0));
+            std::fflush(stdout);
+        }
+    }
+
+    std::vector<std::uint64_t> rss(samples.size());
+    std::vector<std::uint64_t> live(samples.size());
+    std::transform(samples.begin(), samples.end(), rss.begin(), [](const SoakSample& s) { return s.rssBytes; });
+    std::transform(samples.begin(), samples.end(), live.begin(),
+                   [](const SoakSample& s) { return s.liveAllocations; });
+
+    const GrowthTrend rssTrend = detectGrowth(rss, kRssTolerance);
+    const GrowthTrend liveTrend = detectGrowth(live, kLiveAllocationTolerance);
+
+    std::printf("\n%llu levels (%llu cleared by the bot), %llu ticks\n",
+                static_cast<unsigned long long>(options.levels), static_cast<unsigned long long>(cleared),
+                static_cast<unsigned long long>(tick));
+    if (haveRss) {
+        printTrend("rss", rssTrend, "bytes");
+    } else {
+        std::printf("rss               not available on this platform\n");
+    }
+    if (logic::AllocationCounter::enabled()) {
+        printTrend("live allocations", liveTrend, "allocations");
+    } else {
+        std::printf("live allocations  not counted: build with PACMAN_ALLOC_TRACKING=ON\n");
+    }
+
+    if (options.outputPath) {
+        std::ofstream out(options.outputPath, std::ios::trunc);
+        if (wantsJson(options.outputPath)) {
+            writeJson(out, options, samples, rssTrend, liveTrend);
+        } else {
+            writeCsv(out, samples);
+        }
+        if (!out) {
+            std::fprintf(stderr, "could not write %s\n", options.outputPath);
+            return 2;
+        }
+        std::printf("%zu samples written to %s\n", samples.size(), options.outputPath);
+    }
+
+    return (rssTrend.growing || liveTrend.growing) ? 1 : 0;
+}
+
+} // namespace pacman::bench
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+
+namespace pacman::bench {
+
+/**
+ * @brief Settings of a soak run.
+ */
+struct SoakOptions {
+    std::uint64_t levels{1000};        ///< Levels to play, each ending in World::advanceLevel()
+    std::uint64_t ticksPerLevel{600};  ///< Ticks before a level is skipped if the bot has not cleared it
+    std::uint64_t difficultyCycle{10}; ///< Levels after which the world returns to level 1 difficulty (0: never)
+    std::uint32_t seed{5489u};         ///< Seed of the global Random engine and of the bot's input
+    const char* outputPath{nullptr};   ///< Time series destination: JSON for a ".json" suffix, CSV otherwise
+};
+
+/**
+ * @brief Memory figures taken after a level was reloaded.
+ */
+struct SoakSample {
+    std::uint64_t level{0};           ///< Levels completed so far
+    std::uint64_t tick{0};            ///< Ticks simulated so far
+    double seconds{0.0};              ///< Wall time since the start of the run
+    std::uint64_t rssBytes{0};        ///< Resident set size (0 if not available)
+    std::uint64_t liveAllocations{0}; ///< Allocations not yet freed on the main thread (PACMAN_ALLOC_TRACKING)
+    std::uint64_t allocations{0};     ///< Allocations made on the main thread so far (PACMAN_ALLOC_TRACKING)
+    std::uint64_t entities{0};        ///< Entities in the freshly loaded level
+    int worldLevel{1};                ///< World::currentLevel() of the freshly loaded level (speed and fear scaling)
+};
+
+/**
+ * @brief Verdict on whether a series keeps growing.
+ */
+struct GrowthTrend {
+    bool growing{false};    ///< Every window's minimum is at least the previous one and the total rise is real
+    double perLevel{0.0};   ///< Least-squares slope over the analysed samples
+    std::uint64_t first{0}; ///< Minimum of the first analysed window
+    std::uint64_t last{0};  ///< Minimum of the last window
+};
+
+/**
+ * @brief Checks a per-level series for monotonic growth.
+ *
+ * The first tenth of the series is skipped (allocator and cache warm-up). The rest is split into equal windows and
+ * each window is reduced to its minimum, which filters out transient peaks: a leak raises the floor of every window,
+ * while noise does not. The series counts as growing if no window minimum is lower than the one before and the last
+ * exceeds the first by more than the tolerance.
+ *
+ * @param values One value per sample, in order.
+ * @param tolerance Rise of the window minimum that still counts as noise.
+ * @return Verdict and slope; never growing for series too short to split.
+ */
+GrowthTrend detectGrowth(std::span<const std::uint64_t> values, std::uint64_t tolerance);
+
+/**
+ * @brief Plays levels back to back with random input and samples memory after every reload.
+ *
+ * Each level runs until it is cleared or for ticksPerLevel ticks, then World::advanceLevel() recreates every
+ * entity. Running out of lives only refills them. Level speed and fear scaling compound, so every difficultyCycle
+ * levels the reloaded world is put back to its level 1 state (the global Random engine keeps running) to keep the
+ * workload close to real play. Prints a summary and, if requested, writes the time series.
+ *
+ * @param options Run settings.
+ * @return 0 if neither RSS nor live allocations kept growing, 1 if one did, 2 if the output could not be written.
+ */
+int runSoak(const SoakOptions& options);
+
+} // namespace pacman::bench
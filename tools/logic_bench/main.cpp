@@ -0,0 +1,322 @@
+#include "Scenarios.h"
+#include "Soak.h"
+
+#include "entities/Direction.h"
+#include "factory/ModelFactory.h"
+#include "observer/Event.h"
+#include "score/Score.h"
+#include "utils/AllocationCounter.h"
+#include "utils/PerfCounters.h"
+#include "utils/SamplingProfiler.h"
+#include "utils/Profiler.h"
+#include "utils/Random.h"
+#include "world/TileMap.h"
+#include "world/World.h"
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <optional>
+
+namespace {
+
+using pacman::logic::PerfCounter;
+using pacman::logic::PerfCounters;
+using pacman::logic::ProfilePhase;
+
+constexpr std::size_t kWorldPhases = static_cast<std::size_t>(ProfilePhase::Fear) + 1;
+constexpr double kTickDt = 1.0 / 60.0;
+constexpr std::uint64_t kAllocationWarmupTicks = 60; ///< Ticks after a level load not held to the budget
+
+/**
+ * @brief Command line options of the runner.
+ */
+struct Options {
+    std::uint64_t ticks{6000};
+    std::uint32_t seed{5489u};
+    bool counters{false};
+    std::optional<std::uint64_t> allocationBudget;
+    const char* samplePath{nullptr};
+    unsigned sampleHz{pacman::logic::SamplingProfiler::DefaultHz};
+    const char* scenario{nullptr};
+    bool requireAllocationTracking{false};
+    std::optional<pacman::bench::SoakOptions> soak;
+};
+
+/**
+ * @brief Parses the command line.
+ * @param argc Argument count.
+ * @param argv Arguments.
+ * @return Parsed options.
+ */
+Options parseOptions(int argc, char** argv) {
+    Options options;
+    std::optional<std::uint64_t> soakTicks;
+    std::optional<std::uint64_t> soakCycle;
+    const char* soakOut = nullptr;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--ticks") == 0 && i + 1 < argc) {
+            options.ticks = std::strtoull(argv[++i], nullptr, 10);
+        } else if (std::strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            options.seed = static_cast<std::uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (std::strcmp(argv[i], "--counters") == 0) {
+            options.counters = true;
+        } else if (std::strcmp(argv[i], "--alloc-budget") == 0 && i + 1 < argc) {
+            options.allocationBudget = std::strtoull(argv[++i], nullptr, 10);
+        } else if (std::strcmp(argv[i], "--sample") == 0 && i + 1 < argc) {
+            options.samplePath = argv[++i];
+        } else if (std::strcmp(argv[i], "--sample-hz") == 0 && i + 1 < argc) {
+            options.sampleHz = static_cast<unsigned>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (std::strcmp(argv[i], "--scenario") == 0 && i + 1 < argc) {
+            options.scenario = argv[++i];
+        } else if (std::strcmp(argv[i], "--require-alloc-tracking") == 0) {
+            options.requireAllocationTracking = true;
+        } else if (std::strcmp(argv[i], "--soak") == 0 && i + 1 < argc) {
+            options.soak.emplace().levels = std::strtoull(argv[++i], nullptr, 10);
+        } else if (std::strcmp(argv[i], "--soak-ticks") == 0 && i + 1 < argc) {
+            soakTicks = std::strtoull(argv[++i], nullptr, 10);
+        } else if (std::strcmp(argv[i], "--soak-cycle") == 0 && i + 1 < argc) {
+            soakCycle = std::strtoull(argv[++i], nullptr, 10);
+        } else if (std::strcmp(argv[i], "--soak-out") == 0 && i + 1 < argc) {
+            soakOut = argv[++i];
+        }
+    }
+
+    if (options.soak) {
+        options.soak->seed = options.seed;
+        options.soak->ticksPerLevel = soakTicks.value_or(options.soak->ticksPerLevel);
+        options.soak->difficultyCycle = soakCycle.value_or(options.soak->difficultyCycle);
+        options.soak->outputPath = soakOut;
+    }
+    return options;
+}
+
+/**
+ * @brief Prints counter totals as IPC and events per tick and per entity.
+ * @param label Row label.
+ * @param counters Collector (for availability of individual counters).
+ * @param sample Accumulated counts.
+ * @param ticks Ticks the counts cover.
+ * @param entityTicks Sum of the entity count over those ticks.
+ */
+void printCounters(const char* label, const PerfCounters& counters, const PerfCounters::Sample& sample,
+                   std::uint64_t ticks, double entityTicks) {
+    const auto perTick = [ticks](std::uint64_t v) { return ticks ? static_cast<double>(v) / ticks : 0.0; };
+    const auto perEntity = [&](PerfCounter c) {
+        return counters.has(c) && entityTicks > 0.0 ? static_cast<double>(sample[c]) / entityTicks : -1.0;
+    };
+
+    const double cycles = static_cast<double>(sample[PerfCounter::Cycles]);
+    const double ipc = (counters.has(PerfCounter::Instructions) && cycles > 0.0)
+                           ? static_cast<double>(sample[PerfCounter::Instructions]) / cycles
+                           : -1.0;
+
+    std::printf("%-18s %12.0f %6.2f %12.3f %12.3f %12.3f\n", label, perTick(sample[PerfCounter::Cycles]), ipc,
+                perEntity(PerfCounter::L1DMisses), perEntity(PerfCounter::LlcMisses),
+                perEntity(PerfCounter::BranchMisses));
+}
+
+/**
+ * @brief Prints the world's work counters as averages per tick.
+ * @param stats Counters accumulated over the run.
+ */
+void printSimStats(const pacman::logic::SimStats& stats) {
+    const double ticks = static_cast<double>(stats.ticks ? stats.ticks : 1);
+    const auto perTick = [ticks](std::uint64_t v) { return static_cast<double>(v) / ticks; };
+
+    std::printf("per tick: %.1f pair tests, %.2f overlaps resolved, %.1f viability checks\n",
+                perTick(stats.pairTests), perTick(stats.overlapsResolved), perTick(stats.moveViabilityChecks));
+    std::printf("          %.2f ghost decisions, %.2f skipped in corridors, %u entities active\n",
+                perTick(stats.ghostDecisions), perTick(stats.ghostDecisionsSkipped), stats.activeEntities);
+    std::printf("events per tick:");
+    for (std::size_t i = 0; i < pacman::logic::EventTypeCount; ++i) {
+        std::printf(" %s %.2f", pacman::logic::eventTypeName(static_cast<pacman::logic::EventType>(i)),
+                    perTick(stats.events[i]));
+    }
+    std::printf("\n\n");
+}
+
+} // namespace
+
+/**
+ * @brief Headless runner: simulates the default level with scripted input and reports time per tick.
+ *
+ * Options:
+ * - "--ticks <n>" number of simulation steps (default 6000),
+ * - "--seed <s>" seed of the global Random engine,
+ * - "--counters" collects hardware counters (cycles, instructions, L1d/LLC/branch misses) through
+ *   perf_event_open and reports IPC and misses per entity. Per-phase rows need a PACMAN_PROFILE build; when the
+ *   counters are not permitted the reason is printed and only timings are reported,
+ * - "--alloc-budget <n>" fails (exit code 1) if a World::update made more than n heap allocations, not counting
+ *   the first ticks after a level load; needs a build with PACMAN_ALLOC_TRACKING,
+ * - "--sample <file>" samples call stacks with SIGPROF during the run and writes them as folded stacks;
+ *   "--sample-hz <n>" changes the rate (default 997),
+ * - "--scenario <name|all>" runs canned scenarios (idle, chase, fear, maze200, level20) instead and checks each
+ *   against its ticks-per-second floor and allocations-per-tick ceiling; exits with 1 if one fails.
+ *   "--require-alloc-tracking" exits with 77 (CTest's skip code) instead of 0 when the floors held but the build
+ *   cannot count allocations,
+ * - "--soak <levels>" plays that many levels back to back with random input, samples RSS and live allocations
+ *   after every level reload and exits with 1 if either keeps growing; "--soak-ticks <n>" caps the ticks per level
+ *   (default 600), "--soak-cycle <n>" returns to level 1 difficulty every n levels (default 10, 0 never) and
+ *   "--soak-out <file>" writes the time series (JSON for a .json suffix, CSV otherwise).
+ *
+ * Cleared levels advance like in the game; when Pac-Man runs out of lives the level is reloaded with fresh lives.
+ */
+int main(int argc, char** argv) {
+    const Options options = parseOptions(argc, argv);
+    if (options.scenario) {
+        return pacman::bench::runScenarios(options.scenario, options.seed, options.requireAllocationTracking);
+    }
+    if (options.soak) {
+        return pacman::bench::runSoak(*options.soak);
+    }
+    if (options.allocationBudget && !pacman::logic::AllocationCounter::enabled()) {
+        std::fprintf(stderr, "--alloc-budget needs a build with PACMAN_ALLOC_TRACKING=ON\n");
+        return 2;
+    }
+    pacman::logic::Random::getInstance().seed(options.seed);
+
+    pacman::logic::Score score;
+    pacman::logic::ModelFactory factory;
+    factory.setScoreObserver(&score);
+
+    pacman::logic::World world(factory);
+    const pacman::logic::TileMap map;
+    world.loadLevel(map);
+
+    auto& profiler = pacman::logic::Profiler::getInstance();
+    profiler.setEnabled(true);
+
+    PerfCounters counters;
+    const bool useCounters = options.counters && counters.available();
+    if (options.counters && !counters.available()) {
+        std::printf("hardware counters disabled: %s\n", counters.error().c_str());
+    } else if (useCounters && !counters.error().empty()) {
+        std::printf("hardware counters incomplete: %s\n", counters.error().c_str());
+    }
+    if (useCounters) {
+        counters.attachToThread();
+    }
+
+    std::array<std::int64_t, kWorldPhases> phaseNs{};
+    PerfCounters::Sample tickCounters{};
+    double entityTicks = 0.0;
+
+    std::uint64_t ticksSinceLoad = 0;
+    std::uint64_t ticksOverBudget = 0;
+    std::uint64_t worstTick = 0;
+
+    auto& sampler = pacman::logic::SamplingProfiler::getInstance();
+    const bool sampling = options.samplePath && sampler.start(options.sampleHz);
+    if (options.samplePath && !sampling) {
+        std::printf("sampling profiler not available on this platform\n");
+    }
+
+    using Clock = std::chrono::steady_clock;
+    Clock::duration elapsed{};
+
+    for (std::uint64_t tick = 0; tick < options.ticks; ++tick) {
+        world.setPacManDirection(pacman::bench::scriptedInput(tick));
+
+        PerfCounters::Sample before{};
+        PerfCounters::Sample after{};
+        if (useCounters) {
+            counters.read(before);
+        }
+
+        const auto allocationsBefore = pacman::logic::AllocationCounter::threadStats().allocations;
+        const auto start = Clock::now();
+        world.update(kTickDt);
+        elapsed += Clock::now() - start;
+        const auto allocations = pacman::logic::AllocationCounter::threadStats().allocations - allocationsBefore;
+
+        if (++ticksSinceLoad > kAllocationWarmupTicks && allocations > worstTick) {
+            worstTick = allocations;
+        }
+        if (options.allocationBudget && ticksSinceLoad > kAllocationWarmupTicks &&
+            allocations > *options.allocationBudget) {
+            ++ticksOverBudget;
+        }
+
+        if (useCounters && counters.read(after)) {
+            for (std::size_t i = 0; i < before.values.size(); ++i) {
+                tickCounters.values[i] += after.values[i] - before.values[i];
+            }
+        }
+
+        entityTicks += static_cast<double>(world.entities().size());
+
+        profiler.endFrame();
+        for (std::size_t i = 0; i < kWorldPhases; ++i) {
+            phaseNs[i] += profiler.frameNs(0, static_cast<ProfilePhase>(i));
+        }
+
+        if (world.isLevelCleared()) {
+            world.advanceLevel();
+            ticksSinceLoad = 0;
+        } else if (world.isGameOver()) {
+            world.resetLives();
+            world.loadLevel(map);
+            ticksSinceLoad = 0;
+        }
+    }
+
+    if (sampling) {
+        if (sampler.writeFolded(options.samplePath)) {
+            std::printf("%llu samples written to %s (%llu dropped)\n",
+                        static_cast<unsigned long long>(sampler.samples()), options.samplePath,
+                        static_cast<unsigned long long>(sampler.dropped()));
+        } else {
+            std::printf("could not write samples to %s\n", options.samplePath);
+        }
+    }
+
+    const double ticks = static_cast<double>(options.ticks ? options.ticks : 1);
+    const double tickUs = std::chrono::duration<double, std::micro>(elapsed).count() / ticks;
+    std::printf("ticks %llu, level %d, score %d, %.1f entities avg\n", static_cast<unsigned long long>(options.ticks),
+                world.currentLevel(), score.value(), entityTicks / ticks);
+    std::printf("World::update %.2f us/tick\n\n", tickUs);
+
+    if (pacman::logic::SimStats::enabled()) {
+        printSimStats(world.stats());
+    }
+
+#if defined(PACMAN_PROFILE)
+    std::printf("%-18s %10s\n", "phase", "us/tick");
+    for (std::size_t i = 0; i < kWorldPhases; ++i) {
+        std::printf("%-18s %10.2f\n", pacman::logic::Profiler::name(static_cast<ProfilePhase>(i)),
+                    static_cast<double>(phaseNs[i]) / ticks / 1000.0);
+    }
+    std::printf("\n");
+#endif
+
+    if (useCounters) {
+        std::printf("%-18s %12s %6s %12s %12s %12s\n", "phase", "cycles/tick", "IPC", "L1d/entity", "LLC/entity",
+                    "br/entity");
+#if defined(PACMAN_PROFILE)
+        for (std::size_t i = 0; i < kWorldPhases; ++i) {
+            const auto phase = static_cast<ProfilePhase>(i);
+            printCounters(pacman::logic::Profiler::name(phase), counters, counters.total(phase), options.ticks,
+                          entityTicks);
+        }
+#endif
+        printCounters("World::update", counters, tickCounters, options.ticks, entityTicks);
+        std::printf("(-1: counter not available)\n\n");
+    }
+
+    if (pacman::logic::AllocationCounter::enabled()) {
+        std::printf("%s", pacman::logic::AllocationCounter::getInstance().report().c_str());
+        std::printf("worst steady tick: %llu allocations\n", static_cast<unsigned long long>(worstTick));
+    }
+    if (options.allocationBudget && ticksOverBudget > 0) {
+        std::printf("FAIL: %llu ticks over the budget of %llu allocations\n",
+                    static_cast<unsigned long long>(ticksOverBudget),
+                    static_cast<unsigned long long>(*options.allocationBudget));
+        return 1;
+    }
+
+    return 0;
+}